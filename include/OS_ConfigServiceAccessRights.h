@@ -19,6 +19,7 @@
 #pragma once
 /* Includes ------------------------------------------------------------------*/
 #include "stdbool.h"
+#include "stdint.h"
 
 /* Exported types/defines/enums ----------------------------------------------*/
 enum
@@ -27,9 +28,10 @@ enum
     OS_CONFIG_ACCESS_RIGHTS_MAX_ENTRY = OS_CONFIG_ACCESS_RIGHTS_VECTOR_SIZE * 8
 };
 
+// Bit n of the mask is set if entry n (the app ID) has the right.
 typedef struct
 {
-    unsigned char rights[OS_CONFIG_ACCESS_RIGHTS_MAX_ENTRY];
+    uint64_t mask;
 } OS_ConfigServiceAccessRights_t;
 
 /* Exported functions --------------------------------------------------------*/
@@ -51,4 +53,20 @@ bool OS_ConfigServiceAccessRights_IsSet(
     OS_ConfigServiceAccessRights_t const* accessRights,
     unsigned int entryIndex);
 
+// Keeps only the entries set in both given rights. The result may be one of
+// the operands.
+void OS_ConfigServiceAccessRights_Intersect(
+    OS_ConfigServiceAccessRights_t* result,
+    OS_ConfigServiceAccessRights_t const* accessRights,
+    OS_ConfigServiceAccessRights_t const* otherAccessRights);
+
+// Tells if at least one entry is set in both given rights.
+bool OS_ConfigServiceAccessRights_Intersects(
+    OS_ConfigServiceAccessRights_t const* accessRights,
+    OS_ConfigServiceAccessRights_t const* otherAccessRights);
+
+// Returns the number of set entries.
+unsigned int OS_ConfigServiceAccessRights_Count(
+    OS_ConfigServiceAccessRights_t const* accessRights);
+
 /** @} */
\ No newline at end of file
@@ -12,8 +12,11 @@
  *
  * @file OS_ConfigServiceBackend.h
  *
- * @brief Depending on which type of backend is built (either a FileSystem or a MemoryBackend)
- * this module collects functions to interact with the backend (read, write, etc.).
+ * @brief Depending on which type of backend is built (either a FileSystem, a
+ * MemoryBackend or, on host builds, a memory mapped or POSIX file) this module
+ * collects functions to interact with the backend (read, write, etc.). Each
+ * backend object refers to a table of operations, so applications can plug in
+ * their own backend implementations as well.
  *
  */
 
@@ -22,6 +25,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "OS_Error.h"
+#include "OS_ConfigServiceBackendCache.h"
 
 #if defined(OS_CONFIG_SERVICE_BACKEND_FILESYSTEM)
 
@@ -45,29 +49,99 @@ typedef struct
 }
 OS_ConfigServiceBackend_FileName_t;
 
+// Size of the blocks OS_ConfigServiceBackend_createFileBackend() writes a new
+// file with. The buffer for them is static, so this is a RAM vs. speed trade.
+#if !defined(OS_CONFIG_BACKEND_CREATE_BLOCK_SIZE)
+#define OS_CONFIG_BACKEND_CREATE_BLOCK_SIZE  256
+#endif
+
+// Number of file backends without a journal that can be open at the same
+// time, see OS_ConfigServiceBackend_initializeFileBackend().
+#if !defined(OS_CONFIG_BACKEND_MAX_OPEN_FILES)
+#define OS_CONFIG_BACKEND_MAX_OPEN_FILES  8
+#endif
+
+// An open backend file. It is not part of the backend object but kept by the
+// journal the backend is attached to, or in a table of open files otherwise,
+// so all copies of a backend object see the same handle.
+typedef struct
+{
+    OS_ConfigServiceBackend_FileName_t name;
+    OS_FileSystem_Handle_t hFs;
+    OS_FileSystemFile_Handle_t hFile;
+    // Cleared if re-opening the file failed on a commit, hFile is stale then
+    // and the file can't be accessed anymore.
+    bool isOpen;
+}
+OS_ConfigServiceBackend_File_t;
+
+// See OS_ConfigServiceJournal.h
+struct OS_ConfigServiceJournal;
+
 #endif // OS_CONFIG_SERVICE_BACKEND_FILESYSTEM
 
 
-typedef enum
+// Largest read OS_ConfigServiceBackend_attachMirror() asks a backend for, so a
+// backend behind a dataport is not asked for more than it can transfer.
+#if !defined(OS_CONFIG_BACKEND_MIRROR_READ_SIZE)
+#define OS_CONFIG_BACKEND_MIRROR_READ_SIZE  4096
+#endif
+
+struct OS_ConfigServiceBackend;
+typedef struct OS_ConfigServiceBackend OS_ConfigServiceBackend_t;
+
+// Operations of a backend implementation. The generic functions below check
+// the record range and handle the cache before they call these, so read and
+// write get a valid range of bufSize bytes starting at recordIndex, which can
+// span several consecutive records.
+typedef struct
 {
-    OS_CONFIG_BACKEND_BACKEND_TYPE_FS   = 1,
-    OS_CONFIG_BACKEND_BACKEND_TYPE_MEM  = 2,
+    OS_Error_t (*read)(
+        OS_ConfigServiceBackend_t* instance,
+        unsigned int recordIndex,
+        void* buf,
+        size_t bufSize);
+
+    OS_Error_t (*write)(
+        OS_ConfigServiceBackend_t* instance,
+        unsigned int recordIndex,
+        const void* buf,
+        size_t bufSize);
+
+    // Optional, NULL if written records are committed right away.
+    OS_Error_t (*flush)(
+        OS_ConfigServiceBackend_t* instance);
+
+    // Optional, NULL if the records are not kept in memory.
+    OS_Error_t (*getPointer)(
+        OS_ConfigServiceBackend_t const* instance,
+        unsigned int firstIndex,
+        void const** records);
+
+    // Optional, NULL if the backend holds no resources.
+    OS_Error_t (*deinit)(
+        OS_ConfigServiceBackend_t* instance);
 }
-OS_ConfigServiceBackend_BackendType_t;
+OS_ConfigServiceBackend_Ops_t;
 
 
-typedef struct
+struct OS_ConfigServiceBackend
 {
-    OS_ConfigServiceBackend_BackendType_t  backendType;
+    OS_ConfigServiceBackend_Ops_t const*  ops;
     union
     {
+        // Set by OS_ConfigServiceBackend_initializeCustomBackend().
+        void* context;
 
 #if defined(OS_CONFIG_SERVICE_BACKEND_FILESYSTEM)
 
         struct
         {
-            OS_ConfigServiceBackend_FileName_t name;
-            OS_FileSystem_Handle_t hFs;
+            // NULL if records are written to the file directly. The file is
+            // held in the given slot of the journal, or of the table of open
+            // files if there is no journal.
+            struct OS_ConfigServiceJournal* journal;
+            unsigned int slot;
         } fileSystem;
 
 #endif // OS_CONFIG_SERVICE_BACKEND_FILESYSTEM
@@ -82,12 +156,35 @@ typedef struct
 
 #endif // OS_CONFIG_SERVICE_BACKEND_MEMORY
 
+#if defined(OS_CONFIG_SERVICE_BACKEND_MMAP)
+
+        struct
+        {
+            void* base;
+            size_t size;
+        } mappedFile;
+
+#endif // OS_CONFIG_SERVICE_BACKEND_MMAP
+
+#if defined(OS_CONFIG_SERVICE_BACKEND_POSIX)
+
+        struct
+        {
+            int fd;
+        } posixFile;
+
+#endif // OS_CONFIG_SERVICE_BACKEND_POSIX
+
     } backend;
 
     unsigned int  numberOfRecords;
     size_t        sizeOfRecord;
-}
-OS_ConfigServiceBackend_t;
+
+    // Optional RAM cache, NULL if records are always read from the backend.
+    OS_ConfigServiceBackendCache_t* cache;
+    // Optional RAM copy of all records, NULL if reads go to the backend.
+    void* mirror;
+};
 
 //------------------------------------------------------------------------------
 // Filesystem Backend API
@@ -104,14 +201,49 @@ OS_ConfigServiceBackend_createFileBackend(
     unsigned int numberOfRecords,
     size_t sizeOfRecord);
 
+// Like OS_ConfigServiceBackend_createFileBackend(), but the file is written in
+// blocks of the size of the given scratch buffer. Provisioning large backends
+// takes far fewer write calls with a buffer of some KiB.
+OS_Error_t
+OS_ConfigServiceBackend_createFileBackendWithBuffer(
+    OS_ConfigServiceBackend_FileName_t name,
+    OS_FileSystem_Handle_t hFs,
+    unsigned int numberOfRecords,
+    size_t sizeOfRecord,
+    void* scratch,
+    size_t scratchSize);
+
 // Initialize the given backend object with the backend layout retrieved from
-// the given file.
+// the given file. The file is kept open until the backend is deinitialized.
+// Copies of the backend object share the open file, e.g. the one handed over
+// to OS_ConfigServiceLib_Init(), so only one of them is deinitialized, the
+// others are left as they are afterwards. Fails with
+// OS_ERROR_INSUFFICIENT_SPACE if OS_CONFIG_BACKEND_MAX_OPEN_FILES files are
+// open already.
 OS_Error_t
 OS_ConfigServiceBackend_initializeFileBackend(
     OS_ConfigServiceBackend_t* instance,
     OS_ConfigServiceBackend_FileName_t name,
     OS_FileSystem_Handle_t hFs);
 
+// Like OS_ConfigServiceBackend_initializeFileBackend(), but written records are
+// collected by the given journal until the backend is flushed. The journal
+// must be initialized before and can be shared by several backends, then a
+// flush of one of them commits the records of all of them together. Writes
+// that do not fit into the journal anymore fail with OS_ERROR_BUFFER_TOO_SMALL.
+OS_Error_t
+OS_ConfigServiceBackend_initializeJournaledFileBackend(
+    OS_ConfigServiceBackend_t* instance,
+    OS_ConfigServiceBackend_FileName_t name,
+    OS_FileSystem_Handle_t hFs,
+    struct OS_ConfigServiceJournal* journal);
+
+// Close the file held open by the given backend object. Does nothing if a copy
+// of the backend object was deinitialized already.
+OS_Error_t
+OS_ConfigServiceBackend_deinitializeFileBackend(
+    OS_ConfigServiceBackend_t* instance);
+
 #endif // OS_CONFIG_SERVICE_BACKEND_FILESYSTEM
 
 
@@ -151,6 +283,88 @@ OS_ConfigServiceBackend_initializeMemBackend(
 #endif // OS_CONFIG_SERVICE_BACKEND_MEMORY
 
 
+//------------------------------------------------------------------------------
+// Memory Mapped File Backend API (POSIX hosts only)
+//------------------------------------------------------------------------------
+
+#if defined(OS_CONFIG_SERVICE_BACKEND_MMAP)
+
+// Management function: creates the given host file to contain the specified
+// backend layout. The layout is the same as the one of a filesystem backend.
+OS_Error_t
+OS_ConfigServiceBackend_createMmapBackend(
+    char const* path,
+    unsigned int numberOfRecords,
+    size_t sizeOfRecord);
+
+// Initialize the given backend object with the backend layout retrieved from
+// the given host file. The file is mapped into memory until the backend is
+// deinitialized.
+OS_Error_t
+OS_ConfigServiceBackend_initializeMmapBackend(
+    OS_ConfigServiceBackend_t* instance,
+    char const* path);
+
+// Sync the records to the file and unmap it.
+OS_Error_t
+OS_ConfigServiceBackend_deinitializeMmapBackend(
+    OS_ConfigServiceBackend_t* instance);
+
+#endif // OS_CONFIG_SERVICE_BACKEND_MMAP
+
+
+//------------------------------------------------------------------------------
+// POSIX File Backend API (POSIX hosts only)
+//------------------------------------------------------------------------------
+
+#if defined(OS_CONFIG_SERVICE_BACKEND_POSIX)
+
+// Management function: creates the given host file to contain the specified
+// backend layout. The layout is the same as the one of a filesystem backend.
+OS_Error_t
+OS_ConfigServiceBackend_createPosixBackend(
+    char const* path,
+    unsigned int numberOfRecords,
+    size_t sizeOfRecord);
+
+// Initialize the given backend object with the backend layout retrieved from
+// the given host file. The file is kept open until the backend is
+// deinitialized and records are accessed with pread() and pwrite().
+OS_Error_t
+OS_ConfigServiceBackend_initializePosixBackend(
+    OS_ConfigServiceBackend_t* instance,
+    char const* path);
+
+// Sync the records to the file and close it.
+OS_Error_t
+OS_ConfigServiceBackend_deinitializePosixBackend(
+    OS_ConfigServiceBackend_t* instance);
+
+#endif // OS_CONFIG_SERVICE_BACKEND_POSIX
+
+
+//------------------------------------------------------------------------------
+// Custom Backend API
+//------------------------------------------------------------------------------
+
+// Initialize the given backend object with a backend implemented by the
+// application. The operations and the context must outlive the backend, read
+// and write are mandatory. Caches and the generic functions work on top of any
+// backend implementation.
+OS_Error_t
+OS_ConfigServiceBackend_initializeCustomBackend(
+    OS_ConfigServiceBackend_t* instance,
+    OS_ConfigServiceBackend_Ops_t const* ops,
+    void* context,
+    unsigned int numberOfRecords,
+    size_t sizeOfRecord);
+
+// Returns the context given to OS_ConfigServiceBackend_initializeCustomBackend().
+void*
+OS_ConfigServiceBackend_getContext(
+    OS_ConfigServiceBackend_t const* instance);
+
+
 //------------------------------------------------------------------------------
 // Generic Function API
 //------------------------------------------------------------------------------
@@ -177,4 +391,78 @@ OS_ConfigServiceBackend_writeRecord(
     const void* buf,
     size_t bufSize);
 
+// Read the given number of consecutive records starting at firstIndex with a
+// single access to the storage, unless a cache is attached.
+OS_Error_t
+OS_ConfigServiceBackend_readRecords(
+    OS_ConfigServiceBackend_t* instance,
+    unsigned int firstIndex,
+    unsigned int numberOfRecords,
+    void* buf,
+    size_t bufSize);
+
+// Counterpart of OS_ConfigServiceBackend_readRecords(), bufSize must match the
+// size of the records exactly.
+OS_Error_t
+OS_ConfigServiceBackend_writeRecords(
+    OS_ConfigServiceBackend_t* instance,
+    unsigned int firstIndex,
+    unsigned int numberOfRecords,
+    const void* buf,
+    size_t bufSize);
+
+// Get a pointer to the given consecutive records, if the backend keeps them in
+// memory or has a mirror. Fails with OS_ERROR_NOT_SUPPORTED for a filesystem
+// backend without a mirror or if a write-back cache may hold newer data.
+OS_Error_t
+OS_ConfigServiceBackend_getRecordPointer(
+    OS_ConfigServiceBackend_t const* instance,
+    unsigned int firstIndex,
+    unsigned int numberOfRecords,
+    void const** records);
+
+// Put a RAM cache in front of the given initialized backend. The cache uses the
+// given buffer for its management data and records, so the buffer size is the
+// memory budget of the cache. Cache and buffer must outlive the backend.
+OS_Error_t
+OS_ConfigServiceBackend_attachCache(
+    OS_ConfigServiceBackend_t* instance,
+    OS_ConfigServiceBackendCache_t* cache,
+    OS_ConfigServiceBackendCache_Policy_t policy,
+    void* buffer,
+    size_t bufferSize);
+
+// Returns the cache of the given backend or NULL if it has none.
+OS_ConfigServiceBackendCache_t*
+OS_ConfigServiceBackend_getCache(
+    OS_ConfigServiceBackend_t const* instance);
+
+// Read all records of the given initialized backend into the given buffer in
+// large sequential reads. From then on records are read from the buffer and
+// written to both, the buffer and the backend. A backend can either have a
+// cache or a mirror. The buffer must outlive the backend.
+OS_Error_t
+OS_ConfigServiceBackend_attachMirror(
+    OS_ConfigServiceBackend_t* instance,
+    void* buffer,
+    size_t bufferSize);
+
+// Returns the size of the buffer OS_ConfigServiceBackend_attachMirror() needs
+// for the given backend.
+size_t
+OS_ConfigServiceBackend_getMirrorSize(
+    OS_ConfigServiceBackend_t const* instance);
+
+// Make sure all records written so far are committed to the storage. This
+// includes the modified records held by a write-back cache.
+OS_Error_t
+OS_ConfigServiceBackend_flush(
+    OS_ConfigServiceBackend_t* instance);
+
+// Write back the cache and release the resources of the given backend object,
+// whatever type it is.
+OS_Error_t
+OS_ConfigServiceBackend_deinitialize(
+    OS_ConfigServiceBackend_t* instance);
+
 /** @} */
@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2020-2024, HENSOLDT Cyber GmbH
+ * 
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * For commercial licensing, contact: info.cyber@hensoldt.net
+ */
+
+/**
+ * @addtogroup BackendCache
+ * @{
+ *
+ * @file OS_ConfigServiceBackendCache.h
+ *
+ * @brief RAM cache for the records of a backend. It holds as many records as
+ * fit into the memory given by the user and evicts the least recently used
+ * record when it runs full.
+ *
+ */
+
+
+#pragma once
+
+/* Includes ------------------------------------------------------------------*/
+#include "OS_Error.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Exported types/defines/enums ----------------------------------------------*/
+
+// Marks an unused slot or the end of a slot list.
+#define OS_CONFIG_BACKEND_CACHE_NO_SLOT  UINT32_MAX
+
+typedef enum
+{
+    // Writes go to the cache and to the backend at the same time.
+    OS_CONFIG_BACKEND_CACHE_POLICY_WRITE_THROUGH  = 1,
+    // Writes only go to the cache. Modified records are written to the
+    // backend when they are evicted or when the backend is flushed.
+    OS_CONFIG_BACKEND_CACHE_POLICY_WRITE_BACK     = 2,
+}
+OS_ConfigServiceBackendCache_Policy_t;
+
+typedef struct
+{
+    // Lookups of reads, so hits / (hits + misses) is the read hit rate.
+    unsigned int hits;
+    unsigned int misses;
+    // Lookups of writes, which keep cached copies up to date.
+    unsigned int writeHits;
+    unsigned int writeMisses;
+    unsigned int evictions;
+    unsigned int writeBacks;
+}
+OS_ConfigServiceBackendCache_Stats_t;
+
+// Internal: management data of a cache slot.
+typedef struct
+{
+    uint32_t recordIndex;
+    uint32_t hashNext;
+    uint32_t lruPrev;
+    uint32_t lruNext;
+    bool     isValid;
+    bool     isDirty;
+}
+OS_ConfigServiceBackendCache_Slot_t;
+
+typedef struct
+{
+    // private (= only to be used by OS_ConfigService implementation)
+    OS_ConfigServiceBackendCache_Policy_t policy;
+    size_t sizeOfRecord;
+    unsigned int numberOfSlots;
+
+    // All of these are located in the buffer given by the user.
+    OS_ConfigServiceBackendCache_Slot_t* slots;
+    uint32_t* buckets;
+    char* data;
+
+    // Most recently used slot is at the head, the eviction candidate at the
+    // tail. Unused slots are taken before any valid slot is evicted.
+    uint32_t lruHead;
+    uint32_t lruTail;
+
+    OS_ConfigServiceBackendCache_Stats_t stats;
+}
+OS_ConfigServiceBackendCache_t;
+
+/* Exported functions --------------------------------------------------------*/
+
+// Set up the cache in the given buffer, which defines the memory budget. Fails
+// if the buffer cannot hold at least one record.
+OS_Error_t
+OS_ConfigServiceBackendCache_init(
+    OS_ConfigServiceBackendCache_t* cache,
+    OS_ConfigServiceBackendCache_Policy_t policy,
+    void* buffer,
+    size_t bufferSize,
+    size_t sizeOfRecord);
+
+// Returns the slot holding the given record or OS_CONFIG_BACKEND_CACHE_NO_SLOT.
+// A found record becomes the most recently used one. The lookup is counted as
+// a read.
+uint32_t
+OS_ConfigServiceBackendCache_find(
+    OS_ConfigServiceBackendCache_t* cache,
+    unsigned int recordIndex);
+
+// Like OS_ConfigServiceBackendCache_find(), but the lookup is counted as a
+// write.
+uint32_t
+OS_ConfigServiceBackendCache_findForWrite(
+    OS_ConfigServiceBackendCache_t* cache,
+    unsigned int recordIndex);
+
+// Returns the slot that the next call of OS_ConfigServiceBackendCache_assign()
+// will take. If it holds a dirty record, the caller has to write it back first.
+uint32_t
+OS_ConfigServiceBackendCache_getVictim(
+    OS_ConfigServiceBackendCache_t const* cache);
+
+// Let the given slot hold the given record. The slot becomes the most recently
+// used one, the caller fills in the data.
+void
+OS_ConfigServiceBackendCache_assign(
+    OS_ConfigServiceBackendCache_t* cache,
+    uint32_t slot,
+    unsigned int recordIndex);
+
+// Drop the given record from the cache, if it is cached at all.
+void
+OS_ConfigServiceBackendCache_invalidate(
+    OS_ConfigServiceBackendCache_t* cache,
+    unsigned int recordIndex);
+
+// Drop whatever the given slot holds, its data is considered clobbered.
+void
+OS_ConfigServiceBackendCache_release(
+    OS_ConfigServiceBackendCache_t* cache,
+    uint32_t slot);
+
+// Returns the first dirty slot starting at the given slot or
+// OS_CONFIG_BACKEND_CACHE_NO_SLOT.
+uint32_t
+OS_ConfigServiceBackendCache_getNextDirty(
+    OS_ConfigServiceBackendCache_t const* cache,
+    uint32_t slot);
+
+void
+OS_ConfigServiceBackendCache_markDirty(
+    OS_ConfigServiceBackendCache_t* cache,
+    uint32_t slot);
+
+// Mark the slot as written back to the backend.
+void
+OS_ConfigServiceBackendCache_markClean(
+    OS_ConfigServiceBackendCache_t* cache,
+    uint32_t slot);
+
+bool
+OS_ConfigServiceBackendCache_isDirty(
+    OS_ConfigServiceBackendCache_t const* cache,
+    uint32_t slot);
+
+unsigned int
+OS_ConfigServiceBackendCache_getRecordIndex(
+    OS_ConfigServiceBackendCache_t const* cache,
+    uint32_t slot);
+
+void*
+OS_ConfigServiceBackendCache_getData(
+    OS_ConfigServiceBackendCache_t const* cache,
+    uint32_t slot);
+
+OS_ConfigServiceBackendCache_Policy_t
+OS_ConfigServiceBackendCache_getPolicy(
+    OS_ConfigServiceBackendCache_t const* cache);
+
+void
+OS_ConfigServiceBackendCache_getStats(
+    OS_ConfigServiceBackendCache_t const* cache,
+    OS_ConfigServiceBackendCache_Stats_t* stats);
+
+void
+OS_ConfigServiceBackendCache_resetStats(
+    OS_ConfigServiceBackendCache_t* cache);
+
+/** @} */
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2020-2024, HENSOLDT Cyber GmbH
+ * 
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * For commercial licensing, contact: info.cyber@hensoldt.net
+ */
+
+/**
+ * @addtogroup Dedup
+ * @{
+ *
+ * @file OS_ConfigServiceDedup.h
+ *
+ * @brief In-memory table of string or blob values stored in a backend, keyed
+ * by a hash of their content. A value that is written again can then refer to
+ * the stored copy instead of getting records of its own. The table only
+ * returns candidates, the caller has to compare the stored content.
+ *
+ */
+
+#pragma once
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Exported types/defines/enums ----------------------------------------------*/
+
+// Capacity of the table. Each value goes into the slot selected by its hash
+// and replaces the value that was in there before.
+#if !defined(OS_CONFIG_SERVICE_DEDUP_MAX_VALUES)
+#define OS_CONFIG_SERVICE_DEDUP_MAX_VALUES  64
+#endif
+
+// Start value of a hash, see OS_ConfigServiceDedup_hash().
+#define OS_CONFIG_SERVICE_DEDUP_HASH_INIT   2166136261u
+
+typedef struct
+{
+    uint32_t hash;
+    uint32_t size;
+    uint32_t index;
+    uint32_t numberOfRecords;  // 0 marks an empty slot
+}
+OS_ConfigServiceDedup_Entry_t;
+
+typedef struct
+{
+    // private (= only to be used by OS_ConfigService implementation)
+    OS_ConfigServiceDedup_Entry_t entries[OS_CONFIG_SERVICE_DEDUP_MAX_VALUES];
+}
+OS_ConfigServiceDedup_t;
+
+/* Exported functions --------------------------------------------------------*/
+
+void
+OS_ConfigServiceDedup_init(
+    OS_ConfigServiceDedup_t* table);
+
+// Continues the given hash over the given data, so a value can be hashed in
+// parts. A new hash starts with OS_CONFIG_SERVICE_DEDUP_HASH_INIT.
+uint32_t
+OS_ConfigServiceDedup_hash(
+    uint32_t hash,
+    void const* data,
+    size_t size);
+
+// Returns false if no value with the given hash and size is known.
+bool
+OS_ConfigServiceDedup_lookup(
+    OS_ConfigServiceDedup_t const* table,
+    uint32_t hash,
+    size_t size,
+    OS_ConfigServiceDedup_Entry_t* entry);
+
+// Remember a value stored in the given records.
+void
+OS_ConfigServiceDedup_insert(
+    OS_ConfigServiceDedup_t* table,
+    uint32_t hash,
+    size_t size,
+    uint32_t index,
+    uint32_t numberOfRecords);
+
+/** @} */
@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2020-2024, HENSOLDT Cyber GmbH
+ * 
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * For commercial licensing, contact: info.cyber@hensoldt.net
+ */
+
+/**
+ * @addtogroup ExtentMap
+ * @{
+ *
+ * @file OS_ConfigServiceExtentMap.h
+ *
+ * @brief In-memory reference counts of the records of a backend. Values that
+ * span several records get a run of consecutive free records (an extent) from
+ * it. Records referenced by more than one value are shared and must not be
+ * written in place. The map is not stored, it is rebuilt from the parameter
+ * records on start-up.
+ *
+ * A bitmap marks the records in use and a second one the shared records, the
+ * counts of shared records are kept in a small table. Records are only shared
+ * if values are deduplicated, so builds without deduplication only pay for the
+ * bitmaps.
+ *
+ */
+
+#pragma once
+
+/* Includes ------------------------------------------------------------------*/
+#include "OS_Error.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Exported types/defines/enums ----------------------------------------------*/
+
+// Capacity of the map. If a backend holds more records, the map is not used
+// and values can only be rewritten within the records they already occupy.
+// The default covers 4 MiB of string records or 8 MiB of blob blocks in 32 KiB
+// per map.
+#if !defined(OS_CONFIG_SERVICE_EXTENT_MAP_MAX_RECORDS)
+#define OS_CONFIG_SERVICE_EXTENT_MAP_MAX_RECORDS  (128 * 1024)
+#endif
+
+// Number of shared records whose count is kept. A record that becomes shared
+// while the table is full stays in use until the map is rebuilt.
+#if !defined(OS_CONFIG_SERVICE_EXTENT_MAP_MAX_SHARED_RECORDS)
+#define OS_CONFIG_SERVICE_EXTENT_MAP_MAX_SHARED_RECORDS  1024
+#endif
+
+enum
+{
+    OS_CONFIG_SERVICE_EXTENT_MAP_WORDS = (OS_CONFIG_SERVICE_EXTENT_MAP_MAX_RECORDS + 63) / 64,
+};
+
+typedef struct
+{
+    uint32_t index;
+    // Number of values referencing the record, at least 2.
+    uint32_t references;
+}
+OS_ConfigServiceExtentMap_SharedRecord_t;
+
+typedef struct
+{
+    // private (= only to be used by OS_ConfigService implementation)
+    bool isValid;
+    unsigned int numberOfRecords;
+    unsigned int numberOfFreeRecords;
+    // Bit k is set if record k is referenced by any value.
+    uint64_t used[OS_CONFIG_SERVICE_EXTENT_MAP_WORDS];
+    // Bit k is set if record k is referenced by more than one value.
+    uint64_t shared[OS_CONFIG_SERVICE_EXTENT_MAP_WORDS];
+    // Counts of shared records, sorted by record index. A shared record
+    // missing here has a saturated count and is never freed.
+    unsigned int numberOfSharedRecords;
+    OS_ConfigServiceExtentMap_SharedRecord_t sharedRecords[OS_CONFIG_SERVICE_EXTENT_MAP_MAX_SHARED_RECORDS];
+}
+OS_ConfigServiceExtentMap_t;
+
+/* Exported functions --------------------------------------------------------*/
+
+// Mark all records of a backend with the given number of records as free. The
+// map is only valid if the backend does not exceed its capacity.
+void
+OS_ConfigServiceExtentMap_init(
+    OS_ConfigServiceExtentMap_t* map,
+    unsigned int numberOfRecords);
+
+bool
+OS_ConfigServiceExtentMap_isValid(
+    OS_ConfigServiceExtentMap_t const* map);
+
+// Adds a reference to each of the given records. Out of range records are
+// skipped, so damaged parameter records cannot break the map.
+void
+OS_ConfigServiceExtentMap_acquire(
+    OS_ConfigServiceExtentMap_t* map,
+    uint32_t firstIndex,
+    uint32_t numberOfRecords);
+
+// Drops a reference from each of the given records, records without any
+// reference left become free. Out of range records are skipped.
+void
+OS_ConfigServiceExtentMap_release(
+    OS_ConfigServiceExtentMap_t* map,
+    uint32_t firstIndex,
+    uint32_t numberOfRecords);
+
+// Looks for the first run of free records of the given length without taking
+// it. Returns OS_ERROR_INSUFFICIENT_SPACE if there is none and
+// OS_ERROR_INVALID_STATE if the map is not valid.
+OS_Error_t
+OS_ConfigServiceExtentMap_find(
+    OS_ConfigServiceExtentMap_t const* map,
+    uint32_t numberOfRecords,
+    uint32_t* firstIndex);
+
+// Like OS_ConfigServiceExtentMap_find(), but acquires the run.
+OS_Error_t
+OS_ConfigServiceExtentMap_allocate(
+    OS_ConfigServiceExtentMap_t* map,
+    uint32_t numberOfRecords,
+    uint32_t* firstIndex);
+
+// Returns the number of values referencing the given record, UINT_MAX if its
+// count is saturated.
+unsigned int
+OS_ConfigServiceExtentMap_getReferences(
+    OS_ConfigServiceExtentMap_t const* map,
+    uint32_t recordIndex);
+
+// Returns true if any of the given records is referenced by more than one
+// value.
+bool
+OS_ConfigServiceExtentMap_isShared(
+    OS_ConfigServiceExtentMap_t const* map,
+    uint32_t firstIndex,
+    uint32_t numberOfRecords);
+
+unsigned int
+OS_ConfigServiceExtentMap_getNumberOfFreeRecords(
+    OS_ConfigServiceExtentMap_t const* map);
+
+// Returns the index behind the last used record, so all records from there on
+// are free.
+uint32_t
+OS_ConfigServiceExtentMap_getEnd(
+    OS_ConfigServiceExtentMap_t const* map);
+
+/** @} */
@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 
 /* Exported types/defines/enums ----------------------------------------------*/
@@ -45,6 +46,8 @@ typedef struct
         struct
         {
             void* instance;
+            // App on whose behalf the instance is accessed.
+            unsigned int appId;
         } local;
     } context;
 }
@@ -63,6 +66,14 @@ OS_ConfigServiceHandle_initLocalHandle(
     void* instance,
     OS_ConfigServiceHandle_t* handle);
 
+// Like OS_ConfigServiceHandle_initLocalHandle(), but the instance is accessed
+// on behalf of the given app, e.g. a client of the server.
+void
+OS_ConfigServiceHandle_initLocalHandleForApp(
+    void* instance,
+    unsigned int appId,
+    OS_ConfigServiceHandle_t* handle);
+
 OS_ConfigServiceHandle_HandleKind_t
 OS_ConfigServiceHandle_getHandleKind(
     OS_ConfigServiceHandle_t handle);
@@ -71,6 +82,10 @@ void*
 OS_ConfigServiceHandle_getLocalInstance(
     OS_ConfigServiceHandle_t handle);
 
+unsigned int
+OS_ConfigServiceHandle_getAppId(
+    OS_ConfigServiceHandle_t handle);
+
 intptr_t
 OS_ConfigServiceHandle_getClientContext(
     OS_ConfigServiceHandle_t* handle
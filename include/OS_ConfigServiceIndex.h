@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2020-2024, HENSOLDT Cyber GmbH
+ * 
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * For commercial licensing, contact: info.cyber@hensoldt.net
+ */
+
+/**
+ * @addtogroup Index
+ * @{
+ *
+ * @file OS_ConfigServiceIndex.h
+ *
+ * @brief In-memory hash index mapping domain names to domain records and
+ * (domain, parameter name) pairs to parameter records. Lookups only return
+ * candidates, the caller has to check the record it fetches for a match.
+ * Additionally, the index keeps the parameters of each domain in a list, so
+ * enumerating a domain does not have to visit the parameters of other domains.
+ * For each app ID, it also keeps a view of the parameters the app may read, so
+ * invisible parameters are skipped without reading their records.
+ *
+ */
+
+#pragma once
+
+/* Includes ------------------------------------------------------------------*/
+#include "OS_Error.h"
+#include "OS_ConfigServiceLibTypes.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Exported types/defines/enums ----------------------------------------------*/
+
+// Capacity of the index. If a configuration holds more domains or parameters,
+// the index is not used and lookups fall back to scanning the backends. Each
+// parameter takes 32 bytes of the index, each domain 20 bytes.
+#if !defined(OS_CONFIG_SERVICE_INDEX_MAX_DOMAINS)
+#define OS_CONFIG_SERVICE_INDEX_MAX_DOMAINS     32
+#endif
+
+#if !defined(OS_CONFIG_SERVICE_INDEX_MAX_PARAMETERS)
+#define OS_CONFIG_SERVICE_INDEX_MAX_PARAMETERS  256
+#endif
+
+// The hash tables are kept at most half full.
+enum
+{
+    OS_CONFIG_SERVICE_INDEX_DOMAIN_SLOTS    = 2 * OS_CONFIG_SERVICE_INDEX_MAX_DOMAINS,
+    OS_CONFIG_SERVICE_INDEX_PARAMETER_SLOTS = 2 * OS_CONFIG_SERVICE_INDEX_MAX_PARAMETERS,
+    OS_CONFIG_SERVICE_INDEX_VIEW_WORDS      = (OS_CONFIG_SERVICE_INDEX_MAX_PARAMETERS + 63) / 64,
+};
+
+typedef struct
+{
+    uint32_t key;
+    uint32_t entry;  // record index + 1, 0 marks an empty slot
+}
+OS_ConfigServiceIndex_Slot_t;
+
+typedef struct
+{
+    // private (= only to be used by OS_ConfigService implementation)
+    bool isValid;
+    unsigned int numberOfDomains;
+    unsigned int numberOfParameters;
+    OS_ConfigServiceIndex_Slot_t domainSlots[OS_CONFIG_SERVICE_INDEX_DOMAIN_SLOTS];
+    OS_ConfigServiceIndex_Slot_t parameterSlots[OS_CONFIG_SERVICE_INDEX_PARAMETER_SLOTS];
+
+    // Parameter record indices grouped by domain and ascending within a
+    // domain. The list of domain d starts at domainStart[d] and ends before
+    // domainStart[d + 1].
+    uint32_t domainParameters[OS_CONFIG_SERVICE_INDEX_MAX_PARAMETERS];
+    uint32_t domainStart[OS_CONFIG_SERVICE_INDEX_MAX_DOMAINS + 1];
+    // Position of each parameter in domainParameters. While the index is
+    // built, it holds the domain of each parameter.
+    uint32_t parameterPosition[OS_CONFIG_SERVICE_INDEX_MAX_PARAMETERS];
+    // Bit k of the view of an app ID is set if the app may read parameter k.
+    uint64_t views[OS_CONFIG_ACCESS_RIGHTS_MAX_ENTRY][OS_CONFIG_SERVICE_INDEX_VIEW_WORDS];
+}
+OS_ConfigServiceIndex_t;
+
+// Position of an ongoing lookup.
+typedef struct
+{
+    uint32_t key;
+    uint32_t slot;
+    uint32_t probes;
+}
+OS_ConfigServiceIndex_Cursor_t;
+
+/* Exported functions --------------------------------------------------------*/
+
+// Empty the index. It does not become valid before it is marked so.
+void
+OS_ConfigServiceIndex_init(
+    OS_ConfigServiceIndex_t* index);
+
+// Domains have to be added in the order of their record indices. Returns
+// OS_ERROR_INSUFFICIENT_SPACE if the capacity is exceeded.
+OS_Error_t
+OS_ConfigServiceIndex_addDomain(
+    OS_ConfigServiceIndex_t* index,
+    OS_ConfigServiceLibTypes_DomainName_t const* domainName,
+    uint32_t domainIndex);
+
+// Parameters have to be added in the order of their record indices. Returns
+// OS_ERROR_INSUFFICIENT_SPACE if the capacity is exceeded.
+OS_Error_t
+OS_ConfigServiceIndex_addParameter(
+    OS_ConfigServiceIndex_t* index,
+    uint32_t domainIndex,
+    OS_ConfigServiceLibTypes_ParameterName_t const* parameterName,
+    uint32_t parameterIndex);
+
+// Takes the read access rights of the given parameter, which must have been
+// added, into the views. Has to be called again when the rights change.
+void
+OS_ConfigServiceIndex_setParameterAccess(
+    OS_ConfigServiceIndex_t* index,
+    uint32_t parameterIndex,
+    OS_ConfigServiceAccessRights_t const* readAccess);
+
+// Build the per-domain parameter lists once all records are added and mark
+// the index as complete, so lookups can rely on it.
+void
+OS_ConfigServiceIndex_complete(
+    OS_ConfigServiceIndex_t* index);
+
+bool
+OS_ConfigServiceIndex_isValid(
+    OS_ConfigServiceIndex_t const* index);
+
+void
+OS_ConfigServiceIndex_beginDomainLookup(
+    OS_ConfigServiceIndex_t const* index,
+    OS_ConfigServiceLibTypes_DomainName_t const* domainName,
+    OS_ConfigServiceIndex_Cursor_t* cursor);
+
+// Returns false if there are no more candidates.
+bool
+OS_ConfigServiceIndex_nextDomain(
+    OS_ConfigServiceIndex_t const* index,
+    OS_ConfigServiceIndex_Cursor_t* cursor,
+    uint32_t* domainIndex);
+
+void
+OS_ConfigServiceIndex_beginParameterLookup(
+    OS_ConfigServiceIndex_t const* index,
+    uint32_t domainIndex,
+    OS_ConfigServiceLibTypes_ParameterName_t const* parameterName,
+    OS_ConfigServiceIndex_Cursor_t* cursor);
+
+// Returns false if there are no more candidates.
+bool
+OS_ConfigServiceIndex_nextParameter(
+    OS_ConfigServiceIndex_t const* index,
+    OS_ConfigServiceIndex_Cursor_t* cursor,
+    uint32_t* parameterIndex);
+
+// Returns the position of the first parameter in the list of the given domain
+// whose record index is not lower than the given one. The position is past the
+// end of the list if there is no such parameter. Returns false if the domain
+// is unknown.
+bool
+OS_ConfigServiceIndex_seekDomainParameter(
+    OS_ConfigServiceIndex_t const* index,
+    uint32_t domainIndex,
+    uint32_t parameterIndex,
+    uint32_t* position);
+
+// Returns false if the position is past the end of the list of the domain.
+bool
+OS_ConfigServiceIndex_getDomainParameter(
+    OS_ConfigServiceIndex_t const* index,
+    uint32_t domainIndex,
+    uint32_t position,
+    uint32_t* parameterIndex);
+
+// Tells if the given app may read the given parameter.
+bool
+OS_ConfigServiceIndex_isParameterVisible(
+    OS_ConfigServiceIndex_t const* index,
+    uint32_t parameterIndex,
+    unsigned int appId);
+
+// Returns the first parameter in the list of the given domain the given app
+// may read, starting at the given position, and updates the position to it.
+// Returns false if there is no such parameter.
+bool
+OS_ConfigServiceIndex_findVisibleDomainParameter(
+    OS_ConfigServiceIndex_t const* index,
+    uint32_t domainIndex,
+    unsigned int appId,
+    uint32_t* position,
+    uint32_t* parameterIndex);
+
+/** @} */
@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2020-2024, HENSOLDT Cyber GmbH
+ * 
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * For commercial licensing, contact: info.cyber@hensoldt.net
+ */
+
+/**
+ * @addtogroup Journal
+ * @{
+ *
+ * @file OS_ConfigServiceJournal.h
+ *
+ * @brief Write-ahead journal for filesystem backends. Records written to a
+ * journaled backend are collected in RAM. When the backend is flushed, all
+ * collected records of all backends sharing the journal are written to the
+ * journal file in one go before they are written to their backend files. An
+ * interrupted update is completed from the journal file on the next start.
+ *
+ */
+
+#pragma once
+
+/* Includes ------------------------------------------------------------------*/
+#include "OS_Error.h"
+#include "OS_ConfigServiceBackend.h"
+
+#if defined(OS_CONFIG_SERVICE_BACKEND_FILESYSTEM)
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Exported types/defines/enums ----------------------------------------------*/
+
+#if !defined(OS_CONFIG_SERVICE_JOURNAL_MAX_BACKENDS)
+#define OS_CONFIG_SERVICE_JOURNAL_MAX_BACKENDS  4
+#endif
+
+// Stored in front of the record data of each journal entry.
+typedef struct
+{
+    char      fileName[OS_CONFIG_BACKEND_MAX_FILE_NAME_SIZE];
+    uint8_t   reserved[3];
+    uint32_t  offset;
+    uint32_t  size;
+}
+OS_ConfigServiceJournal_Entry_t;
+
+// Stored at the beginning of the journal file. A journal file holds a complete
+// update if the magic is set and the checksum matches the entries.
+typedef struct
+{
+    uint32_t  magic;
+    uint32_t  numberOfEntries;
+    uint32_t  size;
+    uint32_t  checksum;
+}
+OS_ConfigServiceJournal_Header_t;
+
+typedef struct
+{
+    // private (= only to be used by OS_ConfigService implementation)
+    OS_ConfigServiceBackend_File_t file;
+    bool isAttached;
+}
+OS_ConfigServiceJournal_Slot_t;
+
+typedef struct OS_ConfigServiceJournal
+{
+    // private (= only to be used by OS_ConfigService implementation)
+    OS_ConfigServiceBackend_FileName_t name;
+    OS_FileSystem_Handle_t hFs;
+
+    // Holds the header and the entries collected so far, exactly as they are
+    // written to the journal file.
+    char* buffer;
+    size_t bufferSize;
+    size_t used;
+
+    // Backend objects are copied around (e.g. into the library), so the files
+    // are kept here and the backends only refer to their slot.
+    OS_ConfigServiceJournal_Slot_t slots[OS_CONFIG_SERVICE_JOURNAL_MAX_BACKENDS];
+}
+OS_ConfigServiceJournal_t;
+
+/* Exported functions --------------------------------------------------------*/
+
+// Set up the journal, which collects records in the given buffer. The buffer
+// has to be aligned to uint32_t and defines how many records can be part of a
+// single update. If the journal file holds a complete update, it is written to
+// the backend files first. So this has to be called before the backend files
+// are opened.
+OS_Error_t
+OS_ConfigServiceJournal_init(
+    OS_ConfigServiceJournal_t* journal,
+    OS_ConfigServiceBackend_FileName_t name,
+    OS_FileSystem_Handle_t hFs,
+    void* buffer,
+    size_t bufferSize);
+
+// Internal: used by OS_ConfigServiceBackend. Takes over the given open file
+// and returns the slot it is kept in.
+OS_Error_t
+OS_ConfigServiceJournal_attach(
+    OS_ConfigServiceJournal_t* journal,
+    OS_ConfigServiceBackend_File_t const* file,
+    unsigned int* slot);
+
+// Returns NULL if the slot is not attached (anymore).
+OS_ConfigServiceBackend_File_t*
+OS_ConfigServiceJournal_getFile(
+    OS_ConfigServiceJournal_t* journal,
+    unsigned int slot);
+
+void
+OS_ConfigServiceJournal_detach(
+    OS_ConfigServiceJournal_t* journal,
+    unsigned int slot);
+
+// Returns OS_ERROR_BUFFER_TOO_SMALL if the data doesn't fit into the buffer
+// anymore, the journal has to be committed first then.
+OS_Error_t
+OS_ConfigServiceJournal_add(
+    OS_ConfigServiceJournal_t* journal,
+    char const* fileName,
+    uint32_t offset,
+    void const* data,
+    size_t size);
+
+// Returns true if the given location is completely covered by a collected
+// entry, so it does not have to be read from the file.
+bool
+OS_ConfigServiceJournal_covers(
+    OS_ConfigServiceJournal_t const* journal,
+    char const* fileName,
+    uint32_t offset,
+    size_t size);
+
+// Puts the collected data of the given location over the data read from the
+// file.
+void
+OS_ConfigServiceJournal_overlay(
+    OS_ConfigServiceJournal_t const* journal,
+    char const* fileName,
+    uint32_t offset,
+    void* data,
+    size_t size);
+
+bool
+OS_ConfigServiceJournal_isEmpty(
+    OS_ConfigServiceJournal_t const* journal);
+
+// Write the collected entries to the journal file and commit it.
+OS_Error_t
+OS_ConfigServiceJournal_write(
+    OS_ConfigServiceJournal_t* journal);
+
+// Returns the entry at the given position of the buffer and the position of
+// the next entry, or NULL at the end. Position 0 is the first entry. The data
+// of an entry directly follows it.
+OS_ConfigServiceJournal_Entry_t const*
+OS_ConfigServiceJournal_getEntry(
+    OS_ConfigServiceJournal_t const* journal,
+    size_t position,
+    size_t* nextPosition);
+
+// Mark the journal file as empty and drop the collected entries, once they
+// are committed to the backend files.
+OS_Error_t
+OS_ConfigServiceJournal_clear(
+    OS_ConfigServiceJournal_t* journal);
+
+#endif // OS_CONFIG_SERVICE_BACKEND_FILESYSTEM
+
+/** @} */
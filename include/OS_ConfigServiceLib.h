@@ -21,6 +21,15 @@
 #include "OS_ConfigServiceLibTypes.h"
 #include "OS_ConfigServiceBackend.h"
 #include "OS_ConfigServiceAccessRights.h"
+#include "OS_ConfigServiceIndex.h"
+#include "OS_ConfigServiceExtentMap.h"
+#include "OS_ConfigServiceDedup.h"
+
+// Number of values a single OS_ConfigServiceLib_parameterSetValuesBatch() can
+// move to new records. The records are reserved before anything is written.
+#if !defined(OS_CONFIG_LIB_BATCH_MAX_RESERVATIONS)
+#define OS_CONFIG_LIB_BATCH_MAX_RESERVATIONS  32
+#endif
 
 // An instance of OS_ConfigService.
 typedef struct
@@ -30,11 +39,32 @@ typedef struct
     OS_ConfigServiceBackend_t stringBackend;
     OS_ConfigServiceBackend_t blobBackend;
 
+    // Name lookups, built by OS_ConfigServiceLib_Init().
+    OS_ConfigServiceIndex_t index;
+    // Used records of the string and blob backends, built by
+    // OS_ConfigServiceLib_Init().
+    OS_ConfigServiceExtentMap_t stringExtents;
+    OS_ConfigServiceExtentMap_t blobExtents;
+
+#if defined(OS_CONFIG_SERVICE_DEDUP)
+    // Known string and blob values, built by OS_ConfigServiceLib_Init().
+    OS_ConfigServiceDedup_t stringValues;
+    OS_ConfigServiceDedup_t blobValues;
+#endif
+
+    // Position of an ongoing compaction, see OS_ConfigServiceLib_compact().
+    uint32_t compactionCursor;
+    bool hasCompactionMoved;
+
     bool isInitialized;
 }
 OS_ConfigServiceLib_t;
 
 /* Exported functions --------------------------------------------------------*/
+// Functions taking an appId check the access rights of the parameters for the
+// app with that ID, i.e. the app on whose behalf the call is made. See
+// OS_ConfigServiceHandle_getAppId().
+
 OS_Error_t
 OS_ConfigServiceLib_Init(
     OS_ConfigServiceLib_t* instance,
@@ -43,6 +73,52 @@ OS_ConfigServiceLib_Init(
     OS_ConfigServiceBackend_t const* stringBackend,
     OS_ConfigServiceBackend_t const* blobBackend);
 
+// Like OS_ConfigServiceLib_Init(), but all records of the four backends are
+// read into the given buffer first. Reads are then served from RAM, writes go
+// to the buffer and the backends. The buffer needs the sum of the mirror sizes
+// of the backends, see OS_ConfigServiceBackend_getMirrorSize(), and must
+// outlive the instance. The backends must not have a cache.
+OS_Error_t
+OS_ConfigServiceLib_InitPreloaded(
+    OS_ConfigServiceLib_t* instance,
+    OS_ConfigServiceBackend_t const* parameterBackend,
+    OS_ConfigServiceBackend_t const* domainBackend,
+    OS_ConfigServiceBackend_t const* stringBackend,
+    OS_ConfigServiceBackend_t const* blobBackend,
+    void* buffer,
+    size_t bufferSize);
+
+// Commit all written records to the storage, including the ones held back by
+// write-back caches.
+OS_Error_t
+OS_ConfigServiceLib_flush(
+    OS_ConfigServiceLib_t* instance);
+
+// Release the backends owned by the library instance, e.g. close the files of
+// filesystem backends.
+OS_Error_t
+OS_ConfigServiceLib_Deinit(
+    OS_ConfigServiceLib_t* instance);
+
+// Move string and blob values towards the start of their backends, so the free
+// records gather at the end. A call visits at most the given number of
+// parameters and can be repeated in idle time, isDone is set once a complete
+// pass over all parameters did not move anything.
+OS_Error_t
+OS_ConfigServiceLib_compact(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int maxParameters,
+    bool* isDone);
+
+// Get the number of records at the start of the string and blob backends that
+// hold values, all records behind them are free. After a compaction, backends
+// can be provisioned with this size.
+OS_Error_t
+OS_ConfigServiceLib_getUsedRecords(
+    OS_ConfigServiceLib_t const* instance,
+    uint32_t* stringRecords,
+    uint32_t* blobRecords);
+
 // Note: enumerator points to first domain. There is always at least one domain.
 OS_Error_t
 OS_ConfigServiceLib_domainEnumeratorInit(
@@ -78,6 +154,7 @@ OS_ConfigServiceLib_domainEnumeratorGetElement(
 OS_Error_t
 OS_ConfigServiceLib_parameterEnumeratorInit(
     OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
     OS_ConfigServiceLibTypes_DomainEnumerator_t const* domainEnumerator,
     OS_ConfigServiceLibTypes_ParameterEnumerator_t* enumerator);
 
@@ -90,18 +167,23 @@ OS_ConfigServiceLib_parameterEnumeratorClose(
 OS_Error_t
 OS_ConfigServiceLib_parameterEnumeratorReset(
     OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
     OS_ConfigServiceLibTypes_ParameterEnumerator_t* enumerator);
 
 // Result: 0 if enumerator could be increased.
 OS_Error_t
 OS_ConfigServiceLib_parameterEnumeratorIncrement(
     OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
     OS_ConfigServiceLibTypes_ParameterEnumerator_t* enumerator);
 
-// Note: May fail because of failed data retrieval. Assume parameter enumerator is valid.
+// Note: May fail because of failed data retrieval. Fails with
+// OS_ERROR_CONFIG_PARAMETER_NOT_FOUND if the parameter is not visible for the
+// app.
 OS_Error_t
 OS_ConfigServiceLib_parameterEnumeratorGetElement(
     OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
     OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
     OS_ConfigServiceLibTypes_Parameter_t* parameter);
 
@@ -115,6 +197,7 @@ OS_ConfigServiceLib_domainGetName(
 OS_Error_t
 OS_ConfigServiceLib_domainCreateParameterEnumerator(
     OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
     OS_ConfigServiceLibTypes_Domain_t const* domain,
     OS_ConfigServiceLibTypes_ParameterName_t const* parameterName,
     OS_ConfigServiceLibTypes_ParameterEnumerator_t* parameterEnumerator);
@@ -123,6 +206,7 @@ OS_ConfigServiceLib_domainCreateParameterEnumerator(
 OS_Error_t
 OS_ConfigServiceLib_domainGetElement(
     OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
     OS_ConfigServiceLibTypes_Domain_t const* domain,
     OS_ConfigServiceLibTypes_ParameterName_t const* parameterName,
     OS_ConfigServiceLibTypes_Parameter_t* parameter);
@@ -144,10 +228,13 @@ size_t
 OS_ConfigServiceLib_parameterGetSize(
     OS_ConfigServiceLibTypes_Parameter_t const* parameter);
 
-// Get the parameter value - raw format.
+// Get the parameter value - raw format. The value is read from the parameter
+// record the given parameter was read from, the given copy only provides its
+// index.
 OS_Error_t
 OS_ConfigServiceLib_parameterGetValue(
     OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
     OS_ConfigServiceLibTypes_Parameter_t const* parameter,
     void* buffer,
     size_t bufferSize,
@@ -157,6 +244,7 @@ OS_ConfigServiceLib_parameterGetValue(
 OS_Error_t
 OS_ConfigServiceLib_parameterGetValueAsU32(
     OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
     OS_ConfigServiceLibTypes_Parameter_t const* parameter,
     uint32_t* value);
 
@@ -164,6 +252,7 @@ OS_ConfigServiceLib_parameterGetValueAsU32(
 OS_Error_t
 OS_ConfigServiceLib_parameterGetValueAsU64(
     OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
     OS_ConfigServiceLibTypes_Parameter_t const* parameter,
     uint64_t* value);
 
@@ -171,6 +260,7 @@ OS_ConfigServiceLib_parameterGetValueAsU64(
 OS_Error_t
 OS_ConfigServiceLib_parameterGetValueAsString(
     OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
     OS_ConfigServiceLibTypes_Parameter_t const* parameter,
     char* buffer,
     size_t bufferSize);
@@ -179,14 +269,42 @@ OS_ConfigServiceLib_parameterGetValueAsString(
 OS_Error_t
 OS_ConfigServiceLib_parameterGetValueAsBlob(
     OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
     OS_ConfigServiceLibTypes_Parameter_t const* parameter,
     void* buffer,
     size_t bufferSize);
 
+// Read a part of a blob value. A range reaching beyond the end of the blob is
+// cut short, bytesCopied tells how much was read.
+OS_Error_t
+OS_ConfigServiceLib_parameterReadBlobRange(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    size_t offset,
+    void* buffer,
+    size_t length,
+    size_t* bytesCopied);
+
+// Get a pointer to a string or blob value in the backend, so nothing is
+// copied. Only supported by backends that keep their records in memory. The
+// pointer is invalidated by any write to the configuration, by releasing a
+// shared value and by a compaction step, as these may reuse or move the
+// records. Integer values are not supported, they are read with
+// OS_ConfigServiceLib_parameterGetValueAsU32() or ...AsU64().
+OS_Error_t
+OS_ConfigServiceLib_parameterGetValuePointer(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_Parameter_t const* parameter,
+    void const** value,
+    size_t* valueSize);
+
 // Set the parameter value - raw format.
 OS_Error_t
 OS_ConfigServiceLib_parameterSetValue(
     OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
     OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
     OS_ConfigServiceLibTypes_ParameterType_t parameterType,
     void const* buffer,
@@ -196,6 +314,7 @@ OS_ConfigServiceLib_parameterSetValue(
 OS_Error_t
 OS_ConfigServiceLib_parameterSetValueAsU32(
     OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
     OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
     uint32_t value);
 
@@ -203,6 +322,7 @@ OS_ConfigServiceLib_parameterSetValueAsU32(
 OS_Error_t
 OS_ConfigServiceLib_parameterSetValueAsU64(
     OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
     OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
     uint64_t value);
 
@@ -210,6 +330,7 @@ OS_ConfigServiceLib_parameterSetValueAsU64(
 OS_Error_t
 OS_ConfigServiceLib_parameterSetValueAsString(
     OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
     OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
     OS_ConfigServiceLibTypes_ParameterType_t parameterType,
     char const* buffer,
@@ -219,19 +340,98 @@ OS_ConfigServiceLib_parameterSetValueAsString(
 OS_Error_t
 OS_ConfigServiceLib_parameterSetValueAsBlob(
     OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
     OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
     OS_ConfigServiceLibTypes_ParameterType_t parameterType,
     void const* buffer,
     size_t bufferSize);
 
+// Write a part of a blob value, so large blobs can be written in chunks. The
+// size of the whole value is passed with every chunk and becomes the size of
+// the blob.
+OS_Error_t
+OS_ConfigServiceLib_parameterWriteBlobRange(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    size_t blobSize,
+    size_t offset,
+    void const* buffer,
+    size_t length);
+
+// Change the capacity of a blob value. The capacity is rounded up to whole
+// blocks of the blob backend. A blob that grows beyond its blocks is moved to
+// free blocks, a blob that is larger than the new capacity is cut short.
+OS_Error_t
+OS_ConfigServiceLib_parameterResizeBlob(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    size_t capacity);
+
 OS_Error_t
 OS_ConfigServiceLib_parameterGetValueFromDomainName(
     OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_DomainName_t const* domainName,
+    OS_ConfigServiceLibTypes_ParameterName_t const* parameterName,
+    OS_ConfigServiceLibTypes_ParameterType_t parameterType,
+    void* buffer,
+    size_t bufferSize,
+    size_t* bytesCopied);
+
+// Look up a parameter once and get an ID for it, which is valid as long as the
+// layout of the configuration does not change.
+OS_Error_t
+OS_ConfigServiceLib_parameterResolve(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
     OS_ConfigServiceLibTypes_DomainName_t const* domainName,
     OS_ConfigServiceLibTypes_ParameterName_t const* parameterName,
+    OS_ConfigServiceLibTypes_ParameterId_t* parameterId);
+
+OS_Error_t
+OS_ConfigServiceLib_parameterGetValueById(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_ParameterId_t parameterId,
     OS_ConfigServiceLibTypes_ParameterType_t parameterType,
     void* buffer,
     size_t bufferSize,
     size_t* bytesCopied);
 
+OS_Error_t
+OS_ConfigServiceLib_parameterSetValueById(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_ParameterId_t parameterId,
+    OS_ConfigServiceLibTypes_ParameterType_t parameterType,
+    void const* buffer,
+    size_t bufferSize);
+
+// Fetch the values of several parameters at once. The values are packed into
+// the buffer, each entry gets its own result. Returns the error of the first
+// failed entry, if any.
+OS_Error_t
+OS_ConfigServiceLib_parameterGetValuesBatch(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_BatchEntry_t* entries,
+    size_t numberOfEntries,
+    void* buffer,
+    size_t bufferSize,
+    size_t* bytesCopied);
+
+// Set the values of several parameters at once. The value of each entry is
+// located at its offset in the buffer. If any entry is rejected, no value is
+// written at all, otherwise all values are committed to the storage together.
+OS_Error_t
+OS_ConfigServiceLib_parameterSetValuesBatch(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_BatchEntry_t* entries,
+    size_t numberOfEntries,
+    void const* buffer,
+    size_t bufferSize);
+
 /** @} */
@@ -21,6 +21,8 @@
 #include "stdint.h"
 #include "stddef.h"
 
+#include "OS_Error.h"
+
 #include "OS_ConfigServiceAccessRights.h"
 
 /* Exported types/defines/enums ----------------------------------------------*/
@@ -29,8 +31,11 @@
 // Important: these limits have to be small enough to be allocated on the stack.
 typedef enum
 {
-    //! max size of a parameter string including null terminator
+    //! max size of a record of the string backend, longer strings span
+    //! several consecutive records
     OS_CONFIG_LIB_PARAMETER_MAX_STRING_SIZE = 32,
+    //! max size of a parameter string including null terminator
+    OS_CONFIG_LIB_PARAMETER_MAX_STRING_VALUE_SIZE = 256,
     //! max size of blob block
     OS_CONFIG_LIB_PARAMETER_MAX_BLOB_BLOCK_SIZE = 64,
     //! max size of a parameter name including null terminator
@@ -58,7 +63,9 @@ typedef struct
 OS_ConfigServiceLibTypes_ParameterName_t;
 
 
-// The value of a string paramter. The index points into a dedicated record backend.
+// The value of a string paramter. The index points into a dedicated record
+// backend, the string occupies as many consecutive records from there on as its
+// size requires, but at least one.
 typedef struct
 {
     // The storage layout of these structs is required to be the same accross
@@ -134,10 +141,23 @@ typedef struct
     OS_ConfigServiceLibTypes_ParameterValue_t parameterValue;
     OS_ConfigServiceAccessRights_t readAccess;
     OS_ConfigServiceAccessRights_t writeAccess;
+    // Index of the parameter record this was read from. The value is read
+    // from the record again, so a modified copy cannot bypass the access
+    // rights.
+    uint32_t index;
 }
 OS_ConfigServiceLibTypes_Parameter_t;
 
 
+// Identifies a parameter without searching it by name again. It is the index of
+// the parameter record, so it stays the same as long as the layout of the
+// configuration does not change.
+typedef uint32_t OS_ConfigServiceLibTypes_ParameterId_t;
+
+// Marks a parameter ID which is not resolved yet.
+#define OS_CONFIG_LIB_PARAMETER_ID_NONE  UINT32_MAX
+
+
 // Name of a domain.
 typedef struct
 {
@@ -155,4 +175,31 @@ typedef struct
 }
 OS_ConfigServiceLibTypes_Domain_t;
 
-/** @} */
\ No newline at end of file
+// One parameter of a batch request. The parameter is either given by its ID or,
+// if the ID is OS_CONFIG_LIB_PARAMETER_ID_NONE, by its domain and parameter
+// name. In the latter case the resolved ID is returned, so it can be used for
+// further requests.
+typedef struct
+{
+    // in
+    OS_ConfigServiceLibTypes_DomainName_t domainName;
+    OS_ConfigServiceLibTypes_ParameterName_t parameterName;
+    OS_ConfigServiceLibTypes_ParameterType_t parameterType;
+    // in, out
+    OS_ConfigServiceLibTypes_ParameterId_t parameterId;
+    // out
+    OS_Error_t result;
+    // Location of the value in the buffer. Returned when getting values,
+    // given by the caller when setting values.
+    uint32_t offset;
+    uint32_t size;
+}
+OS_ConfigServiceLibTypes_BatchEntry_t;
+
+// A batch request is passed to the server in the dataport, the entries first
+// and the values behind them.
+#define OS_CONFIG_LIB_BATCH_VALUES_OFFSET(numberOfEntries) \
+    (((numberOfEntries) * sizeof(OS_ConfigServiceLibTypes_BatchEntry_t) + 7) \
+     & ~(size_t)7)
+
+/** @} */
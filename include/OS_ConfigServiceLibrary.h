@@ -197,4 +197,69 @@ OS_ConfigServiceLibrary_parameterGetValueFromDomainName(
     size_t bufferSize,
     size_t* bytesCopied);
 
+OS_Error_t
+OS_ConfigServiceLibrary_parameterResolve(
+    OS_ConfigServiceHandle_t handle,
+    OS_ConfigServiceLibTypes_DomainName_t const* domainName,
+    OS_ConfigServiceLibTypes_ParameterName_t const* parameterName,
+    OS_ConfigServiceLibTypes_ParameterId_t* parameterId);
+
+OS_Error_t
+OS_ConfigServiceLibrary_parameterGetValueById(
+    OS_ConfigServiceHandle_t handle,
+    OS_ConfigServiceLibTypes_ParameterId_t parameterId,
+    OS_ConfigServiceLibTypes_ParameterType_t parameterType,
+    void* buffer,
+    size_t bufferSize,
+    size_t* bytesCopied);
+
+OS_Error_t
+OS_ConfigServiceLibrary_parameterSetValueById(
+    OS_ConfigServiceHandle_t handle,
+    OS_ConfigServiceLibTypes_ParameterId_t parameterId,
+    OS_ConfigServiceLibTypes_ParameterType_t parameterType,
+    void const* buffer,
+    size_t bufferSize);
+
+OS_Error_t
+OS_ConfigServiceLibrary_parameterGetValuesBatch(
+    OS_ConfigServiceHandle_t handle,
+    OS_ConfigServiceLibTypes_BatchEntry_t* entries,
+    size_t numberOfEntries,
+    void* buffer,
+    size_t bufferSize,
+    size_t* bytesCopied);
+
+OS_Error_t
+OS_ConfigServiceLibrary_parameterSetValuesBatch(
+    OS_ConfigServiceHandle_t handle,
+    OS_ConfigServiceLibTypes_BatchEntry_t* entries,
+    size_t numberOfEntries,
+    void const* buffer,
+    size_t bufferSize);
+
+OS_Error_t
+OS_ConfigServiceLibrary_parameterReadBlobRange(
+    OS_ConfigServiceHandle_t handle,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    size_t offset,
+    void* buffer,
+    size_t length,
+    size_t* bytesCopied);
+
+OS_Error_t
+OS_ConfigServiceLibrary_parameterWriteBlobRange(
+    OS_ConfigServiceHandle_t handle,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    size_t blobSize,
+    size_t offset,
+    void const* buffer,
+    size_t length);
+
+OS_Error_t
+OS_ConfigServiceLibrary_parameterResizeBlob(
+    OS_ConfigServiceHandle_t handle,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    size_t capacity);
+
 /** @} */
\ No newline at end of file
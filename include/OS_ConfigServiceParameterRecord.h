@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2020-2024, HENSOLDT Cyber GmbH
+ * 
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * For commercial licensing, contact: info.cyber@hensoldt.net
+ */
+
+/**
+ * @addtogroup ParameterRecord
+ * @{
+ *
+ * @file OS_ConfigServiceParameterRecord.h
+ *
+ * @brief Storage layouts of parameter records. Version 1 is the original
+ * layout of OS_ConfigServiceLibTypes_Parameter_t, which is mostly taken by the
+ * access rights, version 2 is the compact one. The library tells both apart by
+ * the record size of the parameter backend.
+ *
+ */
+
+#pragma once
+
+/* Includes ------------------------------------------------------------------*/
+#include "OS_Error.h"
+#include "OS_ConfigServiceLibTypes.h"
+#include "OS_ConfigServiceBackend.h"
+
+#include <stdint.h>
+
+/* Exported types/defines/enums ----------------------------------------------*/
+
+enum
+{
+    // Zero filled records of a freshly created backend are unused parameters.
+    OS_CONFIG_SERVICE_PARAMETER_RECORD_VERSION_NONE = 0,
+    OS_CONFIG_SERVICE_PARAMETER_RECORD_VERSION_2    = 2,
+};
+
+// Access rights of version 1 records take a byte per 8 entries, using the low
+// 4 bits only. This has to stay as it is to read existing configurations.
+enum
+{
+    OS_CONFIG_SERVICE_PARAMETER_RECORD_V1_RIGHTS_SIZE = 64,
+};
+
+typedef struct
+{
+    // The storage layout of these structs is required to be the same accross
+    // different platforms so the int size needs to be explicit.
+    uint32_t  parameterType;
+    char      name[OS_CONFIG_LIB_PARAMETER_NAME_SIZE];
+    uint32_t  domainIndex;
+    OS_ConfigServiceLibTypes_ParameterValue_t parameterValue;
+    uint8_t   readAccess[OS_CONFIG_SERVICE_PARAMETER_RECORD_V1_RIGHTS_SIZE];
+    uint8_t   writeAccess[OS_CONFIG_SERVICE_PARAMETER_RECORD_V1_RIGHTS_SIZE];
+}
+__attribute__((packed)) OS_ConfigServiceParameterRecordV1_t;
+
+typedef struct
+{
+    // The storage layout of these structs is required to be the same accross
+    // different platforms so the int size needs to be explicit.
+    uint8_t   version;
+    uint8_t   parameterType;
+    uint16_t  reserved;
+    // Hash of the name, so records of other names can be skipped without
+    // comparing the name.
+    uint32_t  nameHash;
+    uint32_t  domainIndex;
+    OS_ConfigServiceLibTypes_ParameterValue_t parameterValue;
+    // Bit n is set if app ID n has the right.
+    uint64_t  readAccess;
+    uint64_t  writeAccess;
+    char      name[OS_CONFIG_LIB_PARAMETER_NAME_SIZE];
+}
+__attribute__((packed)) OS_ConfigServiceParameterRecord_t;
+
+/* Exported functions --------------------------------------------------------*/
+
+uint32_t
+OS_ConfigServiceParameterRecord_hashName(
+    OS_ConfigServiceLibTypes_ParameterName_t const* parameterName);
+
+void
+OS_ConfigServiceParameterRecord_encode(
+    OS_ConfigServiceParameterRecord_t* record,
+    OS_ConfigServiceLibTypes_Parameter_t const* parameter);
+
+// Returns OS_ERROR_NOT_SUPPORTED if the record has an unknown version.
+OS_Error_t
+OS_ConfigServiceParameterRecord_decode(
+    OS_ConfigServiceLibTypes_Parameter_t* parameter,
+    OS_ConfigServiceParameterRecord_t const* record);
+
+void
+OS_ConfigServiceParameterRecord_encodeV1(
+    OS_ConfigServiceParameterRecordV1_t* record,
+    OS_ConfigServiceLibTypes_Parameter_t const* parameter);
+
+void
+OS_ConfigServiceParameterRecord_decodeV1(
+    OS_ConfigServiceLibTypes_Parameter_t* parameter,
+    OS_ConfigServiceParameterRecordV1_t const* record);
+
+// Management function: copies the version 1 records of the given backend into
+// the given backend of version 2 records, which needs at least as many
+// records. Domain, string and blob backends stay as they are.
+OS_Error_t
+OS_ConfigServiceParameterRecord_convertBackend(
+    OS_ConfigServiceBackend_t* v1Backend,
+    OS_ConfigServiceBackend_t* v2Backend);
+
+/** @} */
@@ -25,6 +25,12 @@
 
 #include "OS_ConfigServiceDataTypes.h"
 
+// A batch update is copied out of the dataport before it is checked, so the
+// client cannot change it meanwhile. Larger batches are rejected.
+#if !defined(OS_CONFIG_SERVICE_SERVER_BATCH_BUFFER_SIZE)
+#define OS_CONFIG_SERVICE_SERVER_BATCH_BUFFER_SIZE  4096
+#endif
+
 /* Exported functions --------------------------------------------------------*/
 OS_Error_t
 OS_ConfigServiceServer_createHandle(
@@ -172,4 +178,57 @@ OS_ConfigServiceServer_parameterGetValueFromDomainName(
     size_t bufferSize,
     size_t* bytesCopied);
 
+OS_Error_t
+OS_ConfigServiceServer_parameterResolve(
+    OS_ConfigServiceLibTypes_DomainName_t const* domainName,
+    OS_ConfigServiceLibTypes_ParameterName_t const* parameterName,
+    OS_ConfigServiceLibTypes_ParameterId_t* parameterId);
+
+OS_Error_t
+OS_ConfigServiceServer_parameterGetValueById(
+    OS_ConfigServiceLibTypes_ParameterId_t parameterId,
+    OS_ConfigServiceLibTypes_ParameterType_t parameterType,
+    size_t bufferSize,
+    size_t* bytesCopied);
+
+OS_Error_t
+OS_ConfigServiceServer_parameterSetValueById(
+    OS_ConfigServiceLibTypes_ParameterId_t parameterId,
+    OS_ConfigServiceLibTypes_ParameterType_t parameterType,
+    size_t bufferSize);
+
+// The entries are passed in the dataport, see
+// OS_CONFIG_LIB_BATCH_VALUES_OFFSET().
+OS_Error_t
+OS_ConfigServiceServer_parameterGetValuesBatch(
+    size_t numberOfEntries,
+    size_t bufferSize,
+    size_t* bytesCopied);
+
+// The entries and values are passed in the dataport, see
+// OS_CONFIG_LIB_BATCH_VALUES_OFFSET().
+OS_Error_t
+OS_ConfigServiceServer_parameterSetValuesBatch(
+    size_t numberOfEntries,
+    size_t bufferSize);
+
+OS_Error_t
+OS_ConfigServiceServer_parameterReadBlobRange(
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    size_t offset,
+    size_t length,
+    size_t* bytesCopied);
+
+OS_Error_t
+OS_ConfigServiceServer_parameterWriteBlobRange(
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    size_t blobSize,
+    size_t offset,
+    size_t length);
+
+OS_Error_t
+OS_ConfigServiceServer_parameterResizeBlob(
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    size_t capacity);
+
 /** @} */
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2020-2024, HENSOLDT Cyber GmbH
+ * 
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * For commercial licensing, contact: info.cyber@hensoldt.net
+ */
+
+/**
+ * @addtogroup SessionTable
+ * @{
+ *
+ * @file OS_ConfigServiceSessionTable.h
+ *
+ * @brief Sessions of the clients of a server, found by the badge of the client
+ * with a hash table. A session keeps the state of one client between calls.
+ *
+ */
+
+#pragma once
+
+/* Includes ------------------------------------------------------------------*/
+#include "OS_Error.h"
+#include "OS_ConfigServiceHandle.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Exported types/defines/enums ----------------------------------------------*/
+
+// Number of clients a server can handle.
+#if !defined(OS_CONFIG_SERVICE_SERVER_MAX_CLIENTS)
+#define OS_CONFIG_SERVICE_SERVER_MAX_CLIENTS  32
+#endif
+
+// The hash table is kept at most half full.
+enum
+{
+    OS_CONFIG_SERVICE_SESSION_TABLE_SLOTS = 2 * OS_CONFIG_SERVICE_SERVER_MAX_CLIENTS,
+};
+
+typedef struct
+{
+    // private (= only to be used by OS_ConfigService implementation)
+    uintptr_t badge;
+    // App ID the access rights are checked for.
+    unsigned int appId;
+    // Copy of the handle created for the client, it holds the dataport.
+    OS_ConfigServiceHandle_t remoteHandle;
+    // Number of calls made by the client.
+    uint32_t numberOfRequests;
+}
+OS_ConfigServiceSession_t;
+
+// A zero filled table is empty.
+typedef struct
+{
+    // private (= only to be used by OS_ConfigService implementation)
+    unsigned int numberOfSessions;
+    OS_ConfigServiceSession_t sessions[OS_CONFIG_SERVICE_SERVER_MAX_CLIENTS];
+    // Session index + 1, 0 marks an empty slot.
+    uint32_t slots[OS_CONFIG_SERVICE_SESSION_TABLE_SLOTS];
+}
+OS_ConfigServiceSessionTable_t;
+
+/* Exported functions --------------------------------------------------------*/
+
+void
+OS_ConfigServiceSessionTable_init(
+    OS_ConfigServiceSessionTable_t* table);
+
+// Returns the session of the given badge, a new one is added if there is none
+// yet. Returns OS_ERROR_INSUFFICIENT_SPACE if the table is full.
+OS_Error_t
+OS_ConfigServiceSessionTable_open(
+    OS_ConfigServiceSessionTable_t* table,
+    uintptr_t badge,
+    OS_ConfigServiceSession_t** session);
+
+// Returns NULL if there is no session of the given badge.
+OS_ConfigServiceSession_t*
+OS_ConfigServiceSessionTable_find(
+    OS_ConfigServiceSessionTable_t* table,
+    uintptr_t badge);
+
+unsigned int
+OS_ConfigServiceSessionTable_getNumberOfSessions(
+    OS_ConfigServiceSessionTable_t const* table);
+
+/** @} */
@@ -807,3 +807,383 @@ OS_ConfigService_parameterGetValueFromDomainName(
                    bytesCopied);
     }
 }
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigService_parameterResolve(
+    OS_ConfigServiceHandle_t handle,
+    OS_ConfigServiceLibTypes_DomainName_t const* domainName,
+    OS_ConfigServiceLibTypes_ParameterName_t const* parameterName,
+    OS_ConfigServiceLibTypes_ParameterId_t* parameterId)
+{
+    if (OS_CONFIG_HANDLE_KIND_RPC == OS_ConfigServiceHandle_getHandleKind(
+            handle))
+    {
+#if defined(OS_CONFIG_SERVICE_CAMKES_CLIENT)
+        return OS_ConfigServiceServer_parameterResolve(
+                   domainName,
+                   parameterName,
+                   parameterId);
+#else
+        return OS_ERROR_INVALID_PARAMETER;
+#endif
+    }
+    else
+    {
+        return OS_ConfigServiceLibrary_parameterResolve(
+                   handle,
+                   domainName,
+                   parameterName,
+                   parameterId);
+    }
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigService_parameterGetValueById(
+    OS_ConfigServiceHandle_t handle,
+    OS_ConfigServiceLibTypes_ParameterId_t parameterId,
+    OS_ConfigServiceLibTypes_ParameterType_t parameterType,
+    void* buffer,
+    size_t bufferSize,
+    size_t* bytesCopied)
+{
+    if (OS_CONFIG_HANDLE_KIND_RPC == OS_ConfigServiceHandle_getHandleKind(
+            handle))
+    {
+#if defined(OS_CONFIG_SERVICE_CAMKES_CLIENT)
+        OS_Error_t err = OS_ConfigServiceServer_parameterGetValueById(
+                             parameterId,
+                             parameterType,
+                             bufferSize,
+                             bytesCopied);
+
+        if (err == OS_SUCCESS)
+        {
+            OS_ConfigService_ClientCtx_t* clientCtx =
+                (OS_ConfigService_ClientCtx_t*)
+                OS_ConfigServiceHandle_getClientContext(&handle);
+
+            if (*bytesCopied > bufferSize)
+            {
+                return OS_ERROR_BUFFER_TOO_SMALL;
+            }
+            memcpy(buffer, *clientCtx->dataport.io, *bytesCopied);
+        }
+
+        return err;
+#else
+        return OS_ERROR_INVALID_PARAMETER;
+#endif
+    }
+    else
+    {
+        return OS_ConfigServiceLibrary_parameterGetValueById(
+                   handle,
+                   parameterId,
+                   parameterType,
+                   buffer,
+                   bufferSize,
+                   bytesCopied);
+    }
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigService_parameterSetValueById(
+    OS_ConfigServiceHandle_t handle,
+    OS_ConfigServiceLibTypes_ParameterId_t parameterId,
+    OS_ConfigServiceLibTypes_ParameterType_t parameterType,
+    void const* buffer,
+    size_t bufferSize)
+{
+    if (OS_CONFIG_HANDLE_KIND_RPC == OS_ConfigServiceHandle_getHandleKind(
+            handle))
+    {
+#if defined(OS_CONFIG_SERVICE_CAMKES_CLIENT)
+        OS_ConfigService_ClientCtx_t* clientCtx =
+            (OS_ConfigService_ClientCtx_t*)
+            OS_ConfigServiceHandle_getClientContext(&handle);
+
+        if (bufferSize > clientCtx->dataport.size)
+        {
+            return OS_ERROR_BUFFER_TOO_SMALL;
+        }
+        memcpy(*clientCtx->dataport.io, buffer, bufferSize);
+
+        return OS_ConfigServiceServer_parameterSetValueById(
+                   parameterId,
+                   parameterType,
+                   bufferSize);
+#else
+        return OS_ERROR_INVALID_PARAMETER;
+#endif
+    }
+    else
+    {
+        return OS_ConfigServiceLibrary_parameterSetValueById(
+                   handle,
+                   parameterId,
+                   parameterType,
+                   buffer,
+                   bufferSize);
+    }
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigService_parameterGetValuesBatch(
+    OS_ConfigServiceHandle_t handle,
+    OS_ConfigServiceLibTypes_BatchEntry_t* entries,
+    size_t numberOfEntries,
+    void* buffer,
+    size_t bufferSize,
+    size_t* bytesCopied)
+{
+    if (OS_CONFIG_HANDLE_KIND_RPC == OS_ConfigServiceHandle_getHandleKind(
+            handle))
+    {
+#if defined(OS_CONFIG_SERVICE_CAMKES_CLIENT)
+        OS_ConfigService_ClientCtx_t* clientCtx =
+            (OS_ConfigService_ClientCtx_t*)
+            OS_ConfigServiceHandle_getClientContext(&handle);
+
+        size_t entriesSize = numberOfEntries *
+                             sizeof(OS_ConfigServiceLibTypes_BatchEntry_t);
+        size_t valuesOffset = OS_CONFIG_LIB_BATCH_VALUES_OFFSET(numberOfEntries);
+
+        if ((numberOfEntries > clientCtx->dataport.size /
+             sizeof(OS_ConfigServiceLibTypes_BatchEntry_t)) ||
+            (valuesOffset > clientCtx->dataport.size))
+        {
+            return OS_ERROR_BUFFER_TOO_SMALL;
+        }
+
+        // Let the server use whatever space of the dataport is left.
+        size_t valuesSize = clientCtx->dataport.size - valuesOffset;
+        if (bufferSize < valuesSize)
+        {
+            valuesSize = bufferSize;
+        }
+
+        // Entries the server does not process keep this result.
+        for (size_t k = 0; k < numberOfEntries; ++k)
+        {
+            entries[k].result = OS_ERROR_GENERIC;
+        }
+
+        char* dataport = *clientCtx->dataport.io;
+        memcpy(dataport, entries, entriesSize);
+
+        OS_Error_t err = OS_ConfigServiceServer_parameterGetValuesBatch(
+                             numberOfEntries,
+                             valuesSize,
+                             bytesCopied);
+
+        // The entries hold their results even if some of them failed.
+        if (*bytesCopied > valuesSize)
+        {
+            return OS_ERROR_BUFFER_TOO_SMALL;
+        }
+        memcpy(entries, dataport, entriesSize);
+        memcpy(buffer, dataport + valuesOffset, *bytesCopied);
+
+        return err;
+#else
+        return OS_ERROR_INVALID_PARAMETER;
+#endif
+    }
+    else
+    {
+        return OS_ConfigServiceLibrary_parameterGetValuesBatch(
+                   handle,
+                   entries,
+                   numberOfEntries,
+                   buffer,
+                   bufferSize,
+                   bytesCopied);
+    }
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigService_parameterSetValuesBatch(
+    OS_ConfigServiceHandle_t handle,
+    OS_ConfigServiceLibTypes_BatchEntry_t* entries,
+    size_t numberOfEntries,
+    void const* buffer,
+    size_t bufferSize)
+{
+    if (OS_CONFIG_HANDLE_KIND_RPC == OS_ConfigServiceHandle_getHandleKind(
+            handle))
+    {
+#if defined(OS_CONFIG_SERVICE_CAMKES_CLIENT)
+        OS_ConfigService_ClientCtx_t* clientCtx =
+            (OS_ConfigService_ClientCtx_t*)
+            OS_ConfigServiceHandle_getClientContext(&handle);
+
+        size_t entriesSize = numberOfEntries *
+                             sizeof(OS_ConfigServiceLibTypes_BatchEntry_t);
+        size_t valuesOffset = OS_CONFIG_LIB_BATCH_VALUES_OFFSET(numberOfEntries);
+
+        if ((numberOfEntries > clientCtx->dataport.size /
+             sizeof(OS_ConfigServiceLibTypes_BatchEntry_t)) ||
+            (valuesOffset > clientCtx->dataport.size) ||
+            (bufferSize > clientCtx->dataport.size - valuesOffset))
+        {
+            return OS_ERROR_BUFFER_TOO_SMALL;
+        }
+
+        // Entries the server does not process keep this result.
+        for (size_t k = 0; k < numberOfEntries; ++k)
+        {
+            entries[k].result = OS_ERROR_GENERIC;
+        }
+
+        char* dataport = *clientCtx->dataport.io;
+        memcpy(dataport, entries, entriesSize);
+        memcpy(dataport + valuesOffset, buffer, bufferSize);
+
+        OS_Error_t err = OS_ConfigServiceServer_parameterSetValuesBatch(
+                             numberOfEntries,
+                             bufferSize);
+
+        memcpy(entries, dataport, entriesSize);
+
+        return err;
+#else
+        return OS_ERROR_INVALID_PARAMETER;
+#endif
+    }
+    else
+    {
+        return OS_ConfigServiceLibrary_parameterSetValuesBatch(
+                   handle,
+                   entries,
+                   numberOfEntries,
+                   buffer,
+                   bufferSize);
+    }
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigService_parameterReadBlobRange(
+    OS_ConfigServiceHandle_t handle,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    size_t offset,
+    void* buffer,
+    size_t length,
+    size_t* bytesCopied)
+{
+    if (OS_CONFIG_HANDLE_KIND_RPC == OS_ConfigServiceHandle_getHandleKind(
+            handle))
+    {
+#if defined(OS_CONFIG_SERVICE_CAMKES_CLIENT)
+        OS_Error_t err = OS_ConfigServiceServer_parameterReadBlobRange(
+                             enumerator,
+                             offset,
+                             length,
+                             bytesCopied);
+
+        if (err == OS_SUCCESS)
+        {
+            OS_ConfigService_ClientCtx_t* clientCtx =
+                (OS_ConfigService_ClientCtx_t*)
+                OS_ConfigServiceHandle_getClientContext(&handle);
+
+            if (*bytesCopied > length)
+            {
+                return OS_ERROR_BUFFER_TOO_SMALL;
+            }
+            memcpy(buffer, *clientCtx->dataport.io, *bytesCopied);
+        }
+
+        return err;
+#else
+        return OS_ERROR_INVALID_PARAMETER;
+#endif
+    }
+    else
+    {
+        return OS_ConfigServiceLibrary_parameterReadBlobRange(
+                   handle,
+                   enumerator,
+                   offset,
+                   buffer,
+                   length,
+                   bytesCopied);
+    }
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigService_parameterWriteBlobRange(
+    OS_ConfigServiceHandle_t handle,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    size_t blobSize,
+    size_t offset,
+    void const* buffer,
+    size_t length)
+{
+    if (OS_CONFIG_HANDLE_KIND_RPC == OS_ConfigServiceHandle_getHandleKind(
+            handle))
+    {
+#if defined(OS_CONFIG_SERVICE_CAMKES_CLIENT)
+        OS_ConfigService_ClientCtx_t* clientCtx =
+            (OS_ConfigService_ClientCtx_t*)
+            OS_ConfigServiceHandle_getClientContext(&handle);
+
+        if (length > clientCtx->dataport.size)
+        {
+            return OS_ERROR_BUFFER_TOO_SMALL;
+        }
+        memcpy(*clientCtx->dataport.io, buffer, length);
+
+        return OS_ConfigServiceServer_parameterWriteBlobRange(
+                   enumerator,
+                   blobSize,
+                   offset,
+                   length);
+#else
+        return OS_ERROR_INVALID_PARAMETER;
+#endif
+    }
+    else
+    {
+        return OS_ConfigServiceLibrary_parameterWriteBlobRange(
+                   handle,
+                   enumerator,
+                   blobSize,
+                   offset,
+                   buffer,
+                   length);
+    }
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigService_parameterResizeBlob(
+    OS_ConfigServiceHandle_t handle,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    size_t capacity)
+{
+    if (OS_CONFIG_HANDLE_KIND_RPC == OS_ConfigServiceHandle_getHandleKind(
+            handle))
+    {
+#if defined(OS_CONFIG_SERVICE_CAMKES_CLIENT)
+        return OS_ConfigServiceServer_parameterResizeBlob(
+                   enumerator,
+                   capacity);
+#else
+        return OS_ERROR_INVALID_PARAMETER;
+#endif
+    }
+    else
+    {
+        return OS_ConfigServiceLibrary_parameterResizeBlob(
+                   handle,
+                   enumerator,
+                   capacity);
+    }
+}
@@ -9,24 +9,27 @@
 /* Includes ------------------------------------------------------------------*/
 #include "OS_ConfigServiceAccessRights.h"
 
+/* Private functions ---------------------------------------------------------*/
+static
+uint64_t
+OS_ConfigServiceAccessRights_entryMask(
+    unsigned int entryIndex)
+{
+    return (uint64_t)1 << entryIndex;
+}
+
 /* Exported functions --------------------------------------------------------*/
 void OS_ConfigServiceAccessRights_ClearAll(
     OS_ConfigServiceAccessRights_t* accessRights)
 {
-    for (unsigned int k = 0; k < OS_CONFIG_ACCESS_RIGHTS_MAX_ENTRY; ++k)
-    {
-        OS_ConfigServiceAccessRights_Clear(accessRights, k);
-    }
+    accessRights->mask = 0;
 }
 
 //------------------------------------------------------------------------------
 void OS_ConfigServiceAccessRights_SetAll(
     OS_ConfigServiceAccessRights_t* accessRights)
 {
-    for (unsigned int k = 0; k < OS_CONFIG_ACCESS_RIGHTS_MAX_ENTRY; ++k)
-    {
-        OS_ConfigServiceAccessRights_Set(accessRights, k);
-    }
+    accessRights->mask = UINT64_MAX;
 }
 
 //------------------------------------------------------------------------------
@@ -36,10 +39,7 @@ void OS_ConfigServiceAccessRights_Set(
 {
     if (entryIndex < OS_CONFIG_ACCESS_RIGHTS_MAX_ENTRY)
     {
-        unsigned int index = entryIndex >> 3;
-        unsigned int bitNumber = entryIndex & 0x03;
-
-        accessRights->rights[index] |= 1u << bitNumber;
+        accessRights->mask |= OS_ConfigServiceAccessRights_entryMask(entryIndex);
     }
     else
     {
@@ -53,10 +53,7 @@ void OS_ConfigServiceAccessRights_Clear(
 {
     if (entryIndex < OS_CONFIG_ACCESS_RIGHTS_MAX_ENTRY)
     {
-        unsigned int index = entryIndex >> 3;
-        unsigned int bitNumber = entryIndex & 0x03;
-
-        accessRights->rights[index] &= ~(1u << bitNumber);
+        accessRights->mask &= ~OS_ConfigServiceAccessRights_entryMask(entryIndex);
     }
     else
     {
@@ -70,13 +67,35 @@ bool OS_ConfigServiceAccessRights_IsSet(
 {
     if (entryIndex < OS_CONFIG_ACCESS_RIGHTS_MAX_ENTRY)
     {
-        unsigned int index = entryIndex >> 3;
-        unsigned int bitNumber = entryIndex & 0x03;
-
-        return 0 != (accessRights->rights[index] & (1u << bitNumber));
+        return 0 != (accessRights->mask &
+                     OS_ConfigServiceAccessRights_entryMask(entryIndex));
     }
     else
     {
         return false;
     }
 }
+
+//------------------------------------------------------------------------------
+void OS_ConfigServiceAccessRights_Intersect(
+    OS_ConfigServiceAccessRights_t* result,
+    OS_ConfigServiceAccessRights_t const* accessRights,
+    OS_ConfigServiceAccessRights_t const* otherAccessRights)
+{
+    result->mask = accessRights->mask & otherAccessRights->mask;
+}
+
+//------------------------------------------------------------------------------
+bool OS_ConfigServiceAccessRights_Intersects(
+    OS_ConfigServiceAccessRights_t const* accessRights,
+    OS_ConfigServiceAccessRights_t const* otherAccessRights)
+{
+    return 0 != (accessRights->mask & otherAccessRights->mask);
+}
+
+//------------------------------------------------------------------------------
+unsigned int OS_ConfigServiceAccessRights_Count(
+    OS_ConfigServiceAccessRights_t const* accessRights)
+{
+    return (unsigned int)__builtin_popcountll(accessRights->mask);
+}
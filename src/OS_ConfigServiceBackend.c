@@ -10,10 +10,47 @@
 #include "lib_debug/Debug.h"
 #include "OS_Error.h"
 #include "OS_ConfigServiceBackend.h"
+#include "OS_ConfigServiceJournal.h"
 
 #include <string.h>
 #include <inttypes.h>
 
+#if defined(OS_CONFIG_SERVICE_BACKEND_MMAP) || \
+    defined(OS_CONFIG_SERVICE_BACKEND_POSIX)
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#endif // OS_CONFIG_SERVICE_BACKEND_MMAP || OS_CONFIG_SERVICE_BACKEND_POSIX
+
+#if defined(OS_CONFIG_SERVICE_BACKEND_MMAP)
+
+#include <sys/mman.h>
+
+#endif // OS_CONFIG_SERVICE_BACKEND_MMAP
+
+static OS_Error_t
+OS_ConfigServiceBackend_writeBackCache(
+    OS_ConfigServiceBackend_t* instance);
+
+#if defined(OS_CONFIG_SERVICE_BACKEND_FILESYSTEM)
+
+static OS_Error_t
+OS_ConfigServiceBackend_commitJournal(
+    OS_ConfigServiceJournal_t* journal);
+
+static OS_Error_t
+flush_backend_filesystem(
+    OS_ConfigServiceBackend_t* instance);
+
+static OS_Error_t
+deinit_backend_filesystem(
+    OS_ConfigServiceBackend_t* instance);
+
+#endif // OS_CONFIG_SERVICE_BACKEND_FILESYSTEM
+
 //------------------------------------------------------------------------------
 // Filesystem Backend API
 //------------------------------------------------------------------------------
@@ -32,98 +69,90 @@ OS_ConfigServiceBackend_BackendFsLayout_t;
 /* Exported functions --------------------------------------------------------*/
 static
 OS_Error_t OS_ConfigServiceBackend_writeToFile(
-    OS_FileSystem_Handle_t  hFs,
-    const char*   name,
+    OS_FileSystem_Handle_t      hFs,
+    OS_FileSystemFile_Handle_t  hFile,
     unsigned int  offset,
-    void*         buffer,
+    void const*   buffer,
     int           size)
 {
-    OS_FileSystemFile_Handle_t hFile;
-
-    // Open file
-    OS_Error_t err = OS_FileSystemFile_open(
-                         hFs,
-                         &hFile,
-                         name,
-                         OS_FileSystem_OpenMode_WRONLY,
-                         OS_FileSystem_OpenFlags_NONE);
-    if (OS_SUCCESS != err)
-    {
-        Debug_LOG_ERROR("OS_FileSystemFile_open() failed with: %d", err);
-        return err;
-    }
-
-    Debug_LOG_DEBUG("file_write name:%s\n", name);
     Debug_LOG_DEBUG("file_write offset:%u\n", offset);
     Debug_LOG_DEBUG("file_write size:%d\n", size);
 
     // Call filesystem API function to write into a file
-    err = OS_FileSystemFile_write(
-              hFs,
-              hFile,
-              (long)offset,
-              (long)size,
-              buffer);
+    OS_Error_t err = OS_FileSystemFile_write(
+                         hFs,
+                         hFile,
+                         (long)offset,
+                         (long)size,
+                         buffer);
     if (OS_SUCCESS != err)
     {
         Debug_LOG_ERROR("OS_FileSystemFile_write() failed with: %d", err);
         return err;
     }
 
-    // Close this file
-    err = OS_FileSystemFile_close(hFs, hFile);
-    if (OS_SUCCESS != err)
-    {
-        Debug_LOG_ERROR("OS_FileSystemFile_close() failed with: %d", err);
-        return err;
-    }
-
     return OS_SUCCESS;
 }
 
 //------------------------------------------------------------------------------
 static
 OS_Error_t OS_ConfigServiceBackend_readFromFile(
-    OS_FileSystem_Handle_t  hFs,
-    const char*   name,
+    OS_FileSystem_Handle_t      hFs,
+    OS_FileSystemFile_Handle_t  hFile,
     unsigned int  offset,
     void*         buffer,
     int           size)
 {
-    OS_FileSystemFile_Handle_t hFile;
+    Debug_LOG_DEBUG("file_read offset:%u\n", offset);
+    Debug_LOG_DEBUG("file_read size:%d\n", size);
 
-    // Open file
-    OS_Error_t err = OS_FileSystemFile_open(
+    // Call filesystem API function to read from a file
+    OS_Error_t err = OS_FileSystemFile_read(
                          hFs,
-                         &hFile,
-                         name,
-                         OS_FileSystem_OpenMode_RDONLY,
-                         OS_FileSystem_OpenFlags_NONE);
+                         hFile,
+                         (long)offset,
+                         (long)size,
+                         buffer);
     if (OS_SUCCESS != err)
     {
-        Debug_LOG_ERROR("OS_FileSystemFile_open() failed with: %d", err);
+        Debug_LOG_ERROR("OS_FileSystemFile_read() failed with: %d", err);
         return err;
     }
 
-    Debug_LOG_DEBUG("file_read name:%s\n", name);
-    Debug_LOG_DEBUG("file_read offset:%u\n", offset);
-    Debug_LOG_DEBUG("file_read size:%d\n", size);
+    return OS_SUCCESS;
+}
 
-    // Call filesystem API function to write into a file
-    err = OS_FileSystemFile_read(
-              hFs,
-              hFile,
-              (long)offset,
-              (long)size,
-              buffer);
+//------------------------------------------------------------------------------
+static
+OS_Error_t OS_ConfigServiceBackend_openFile(
+    OS_FileSystem_Handle_t       hFs,
+    const char*                  name,
+    OS_FileSystemFile_Handle_t*  hFile)
+{
+    Debug_LOG_DEBUG("file_open name:%s\n", name);
+
+    OS_Error_t err = OS_FileSystemFile_open(
+                         hFs,
+                         hFile,
+                         name,
+                         OS_FileSystem_OpenMode_RDWR,
+                         OS_FileSystem_OpenFlags_NONE);
     if (OS_SUCCESS != err)
     {
-        Debug_LOG_ERROR("OS_FileSystemFile_read() failed with: %d", err);
+        Debug_LOG_ERROR("OS_FileSystemFile_open() failed with: %d", err);
         return err;
     }
 
-    // Close this file
-    err = OS_FileSystemFile_close(hFs, hFile);
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+static
+OS_Error_t OS_ConfigServiceBackend_closeFile(
+    OS_FileSystem_Handle_t      hFs,
+    OS_FileSystemFile_Handle_t  hFile)
+{
+    OS_Error_t err = OS_FileSystemFile_close(hFs, hFile);
     if (OS_SUCCESS != err)
     {
         Debug_LOG_ERROR("OS_FileSystemFile_close() failed with: %d", err);
@@ -134,14 +163,19 @@ OS_Error_t OS_ConfigServiceBackend_readFromFile(
 }
 
 //------------------------------------------------------------------------------
+// Creates the file, fills it with zeros and puts the given header at its
+// beginning, all with a single open/close cycle. The file is written in blocks
+// of the size of the given scratch buffer, the header goes into the first one.
 static
 OS_Error_t OS_ConfigServiceBackend_createFile(
     OS_FileSystem_Handle_t  hFs,
     const char*   name,
-    int           size)
+    int           size,
+    void const*   header,
+    int           headerSize,
+    void*         scratch,
+    size_t        scratchSize)
 {
-    enum {BLOCK_SIZE = 256};
-    static char buf[256];
     OS_FileSystemFile_Handle_t hFile;
 
     // Open file
@@ -159,52 +193,74 @@ OS_Error_t OS_ConfigServiceBackend_createFile(
 
     Debug_LOG_DEBUG("file_create: size: %d\n", size);
 
-    // fill buffer with test data
-    memset(buf, 0, BLOCK_SIZE);
+    char* buf = scratch;
+    int blockSize = (scratchSize < (size_t)size) ? (int)scratchSize : size;
 
-    // Call filesystem API function to write into a file
-    unsigned int numberOfBlocks = size / BLOCK_SIZE;
-    unsigned int sizeOfLastBlock = size % BLOCK_SIZE;
-    unsigned int fileSize = 0;
+    memset(buf, 0, blockSize);
+    memcpy(buf, header, headerSize);
 
-    for (unsigned int k = 0; k < numberOfBlocks; ++k)
+    // Call filesystem API function to write into a file
+    for (int fileSize = 0; fileSize < size; fileSize += blockSize)
     {
-        err = OS_FileSystemFile_write(
+        if (blockSize > size - fileSize)
+        {
+            blockSize = size - fileSize;
+        }
+
+        err = OS_ConfigServiceBackend_writeToFile(
                   hFs,
                   hFile,
-                  (long)fileSize,
-                  (long)BLOCK_SIZE,
-                  buf);
+                  fileSize,
+                  buf,
+                  blockSize);
         if (OS_SUCCESS != err)
         {
-            Debug_LOG_ERROR("OS_FileSystemFile_write() failed with: %d", err);
+            OS_ConfigServiceBackend_closeFile(hFs, hFile);
             return err;
         }
 
-        fileSize += BLOCK_SIZE;
+        if (0 == fileSize)
+        {
+            memset(buf, 0, headerSize);
+        }
     }
 
-    err = OS_FileSystemFile_write(
-              hFs,
-              hFile,
-              (long)fileSize,
-              (long)sizeOfLastBlock,
-              buf);
-    if (OS_SUCCESS != err)
+    // Close this file
+    return OS_ConfigServiceBackend_closeFile(hFs, hFile);
+}
+
+//------------------------------------------------------------------------------
+// Files of the backends without a journal. A backend object only holds the
+// slot, so a copy of it does not keep a stale handle once the file is
+// re-opened by a commit.
+static struct
+{
+    bool isUsed;
+    OS_ConfigServiceBackend_File_t file;
+}
+openFiles[OS_CONFIG_BACKEND_MAX_OPEN_FILES];
+
+//------------------------------------------------------------------------------
+// Returns NULL if another copy of the backend object was deinitialized and the
+// file is not held anymore.
+static OS_ConfigServiceBackend_File_t*
+OS_ConfigServiceBackend_getFile(
+    OS_ConfigServiceBackend_t*  instance)
+{
+    unsigned int slot = instance->backend.fileSystem.slot;
+
+    OS_ConfigServiceJournal_t* journal = instance->backend.fileSystem.journal;
+    if (NULL != journal)
     {
-        Debug_LOG_ERROR("OS_FileSystemFile_write() failed with: %d", err);
-        return err;
+        return OS_ConfigServiceJournal_getFile(journal, slot);
     }
 
-    // Close this file
-    err = OS_FileSystemFile_close(hFs, hFile);
-    if (OS_SUCCESS != err)
+    if ((slot >= OS_CONFIG_BACKEND_MAX_OPEN_FILES) || !openFiles[slot].isUsed)
     {
-        Debug_LOG_ERROR("OS_FileSystemFile_close() failed with: %d", err);
-        return err;
+        return NULL;
     }
 
-    return OS_SUCCESS;
+    return &openFiles[slot].file;
 }
 
 //------------------------------------------------------------------------------
@@ -219,11 +275,38 @@ writeRecord_backend_filesystem(
                           recordIndex *
                           instance->sizeOfRecord;
 
+    OS_ConfigServiceBackend_File_t* file =
+        OS_ConfigServiceBackend_getFile(instance);
+    if ((NULL == file) || !file->isOpen)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    OS_ConfigServiceJournal_t* journal = instance->backend.fileSystem.journal;
+    if (NULL != journal)
+    {
+        // A full journal rejects the write with OS_ERROR_BUFFER_TOO_SMALL. It
+        // is not committed here, as it may hold only a part of an update.
+        OS_Error_t err = OS_ConfigServiceJournal_add(
+                             journal,
+                             file->name.buffer,
+                             offset,
+                             buf,
+                             bufSize);
+        if (OS_SUCCESS != err)
+        {
+            Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        }
+
+        return err;
+    }
+
     OS_Error_t writeResult = OS_ConfigServiceBackend_writeToFile(
-                                 instance->backend.fileSystem.hFs,
-                                 instance->backend.fileSystem.name.buffer,
+                                 file->hFs,
+                                 file->hFile,
                                  offset,
-                                 (void*)buf,
+                                 buf,
                                  bufSize);
 
     if (OS_SUCCESS != writeResult)
@@ -246,21 +329,53 @@ readRecord_backend_filesystem(
                           recordIndex *
                           instance->sizeOfRecord;
 
-    OS_Error_t readResult = OS_ConfigServiceBackend_readFromFile(
-                                instance->backend.fileSystem.hFs,
-                                instance->backend.fileSystem.name.buffer,
-                                offset,
-                                buf,
-                                bufSize);
-
-    if (OS_SUCCESS != readResult)
+    OS_ConfigServiceBackend_File_t* file =
+        OS_ConfigServiceBackend_getFile(instance);
+    if ((NULL == file) || !file->isOpen)
     {
         Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    OS_ConfigServiceJournal_t* journal = instance->backend.fileSystem.journal;
+    char const* name = file->name.buffer;
+
+    // Records collected by the journal are not in the file yet.
+    if ((NULL == journal) ||
+        !OS_ConfigServiceJournal_covers(journal, name, offset, bufSize))
+    {
+        OS_Error_t readResult = OS_ConfigServiceBackend_readFromFile(
+                                    file->hFs,
+                                    file->hFile,
+                                    offset,
+                                    buf,
+                                    bufSize);
+
+        if (OS_SUCCESS != readResult)
+        {
+            Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+            return readResult;
+        }
+    }
+
+    if (NULL != journal)
+    {
+        OS_ConfigServiceJournal_overlay(journal, name, offset, buf, bufSize);
     }
 
-    return readResult;
+    return OS_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+static const OS_ConfigServiceBackend_Ops_t OS_ConfigServiceBackend_fileOps =
+{
+    .read       = readRecord_backend_filesystem,
+    .write      = writeRecord_backend_filesystem,
+    .flush      = flush_backend_filesystem,
+    .getPointer = NULL,
+    .deinit     = deinit_backend_filesystem,
+};
+
 //------------------------------------------------------------------------------
 OS_Error_t
 OS_ConfigServiceBackend_createFileBackend(
@@ -268,46 +383,84 @@ OS_ConfigServiceBackend_createFileBackend(
     OS_FileSystem_Handle_t              hFs,
     unsigned int               numberOfRecords,
     size_t                     sizeOfRecord)
+{
+    static uint64_t buf[OS_CONFIG_BACKEND_CREATE_BLOCK_SIZE / sizeof(uint64_t)];
+
+    return OS_ConfigServiceBackend_createFileBackendWithBuffer(
+               name,
+               hFs,
+               numberOfRecords,
+               sizeOfRecord,
+               buf,
+               sizeof(buf));
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceBackend_createFileBackendWithBuffer(
+    OS_ConfigServiceBackend_FileName_t  name,
+    OS_FileSystem_Handle_t              hFs,
+    unsigned int               numberOfRecords,
+    size_t                     sizeOfRecord,
+    void*                      scratch,
+    size_t                     scratchSize)
 {
     size_t fileSize = sizeof(OS_ConfigServiceBackend_BackendFsLayout_t) +
                       numberOfRecords *
                       sizeOfRecord;
     OS_ConfigServiceBackend_BackendFsLayout_t backendFsLayout = {0};
 
-    backendFsLayout.numberOfRecords = numberOfRecords;
-    backendFsLayout.sizeOfRecord = sizeOfRecord;
-
-    OS_Error_t err = OS_ConfigServiceBackend_createFile(hFs, name.buffer,
-                                                        fileSize);
-    if (OS_SUCCESS != err)
+    if ((NULL == scratch) ||
+        (scratchSize < sizeof(OS_ConfigServiceBackend_BackendFsLayout_t)))
     {
-        return err;
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
     }
 
-    return OS_ConfigServiceBackend_writeToFile(
+    backendFsLayout.numberOfRecords = numberOfRecords;
+    backendFsLayout.sizeOfRecord = sizeOfRecord;
+
+    return OS_ConfigServiceBackend_createFile(
                hFs,
                name.buffer,
-               0,
+               fileSize,
                &backendFsLayout,
-               sizeof(OS_ConfigServiceBackend_BackendFsLayout_t));
+               sizeof(OS_ConfigServiceBackend_BackendFsLayout_t),
+               scratch,
+               scratchSize);
 }
 
 //------------------------------------------------------------------------------
-OS_Error_t
-OS_ConfigServiceBackend_initializeFileBackend(
+// Opens the file of a backend and sets up the backend object with its layout.
+// Where the file is kept is up to the caller.
+static OS_Error_t
+OS_ConfigServiceBackend_openBackendFile(
     OS_ConfigServiceBackend_t*          instance,
     OS_ConfigServiceBackend_FileName_t  name,
-    OS_FileSystem_Handle_t              hFs)
+    OS_FileSystem_Handle_t              hFs,
+    OS_ConfigServiceBackend_File_t*     file)
 {
     OS_ConfigServiceBackend_BackendFsLayout_t backendFsLayout;
+    OS_FileSystemFile_Handle_t hFile;
 
-    if (OS_SUCCESS != OS_ConfigServiceBackend_readFromFile(
+    // The file stays open for the lifetime of the backend, so accessing a
+    // record boils down to a single read or write call.
+    if (OS_SUCCESS != OS_ConfigServiceBackend_openFile(
             hFs,
             name.buffer,
+            &hFile))
+    {
+        return OS_ERROR_GENERIC;
+    }
+
+    if (OS_SUCCESS != OS_ConfigServiceBackend_readFromFile(
+            hFs,
+            hFile,
             0,
             &backendFsLayout,
             sizeof(OS_ConfigServiceBackend_BackendFsLayout_t)))
     {
+        OS_ConfigServiceBackend_closeFile(hFs, hFile);
         return OS_ERROR_GENERIC;
     }
 
@@ -315,85 +468,392 @@ OS_ConfigServiceBackend_initializeFileBackend(
     Debug_LOG_DEBUG("number of records: %u\n", backendFsLayout.numberOfRecords);
     Debug_LOG_DEBUG("size of records: %" PRIu64"\n", backendFsLayout.sizeOfRecord);
 
-    instance->backendType = OS_CONFIG_BACKEND_BACKEND_TYPE_FS;
+    file->name = name;
+    file->hFs = hFs;
+    file->hFile = hFile;
+    file->isOpen = true;
 
-    instance->backend.fileSystem.hFs = hFs;
-    instance->backend.fileSystem.name = name;
+    instance->ops = &OS_ConfigServiceBackend_fileOps;
+
+    instance->backend.fileSystem.journal = NULL;
+    instance->backend.fileSystem.slot = 0;
 
     instance->numberOfRecords = backendFsLayout.numberOfRecords;
     instance->sizeOfRecord = backendFsLayout.sizeOfRecord;
 
+    instance->cache = NULL;
+    instance->mirror = NULL;
+
     return OS_SUCCESS;
 }
 
-#endif // OS_CONFIG_SERVICE_BACKEND_FILESYSTEM
-
-
-//------------------------------------------------------------------------------
-// Memory Backend API
 //------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceBackend_initializeFileBackend(
+    OS_ConfigServiceBackend_t*          instance,
+    OS_ConfigServiceBackend_FileName_t  name,
+    OS_FileSystem_Handle_t              hFs)
+{
+    unsigned int slot = 0;
 
-#if defined(OS_CONFIG_SERVICE_BACKEND_MEMORY)
+    while ((slot < OS_CONFIG_BACKEND_MAX_OPEN_FILES) &&
+           openFiles[slot].isUsed)
+    {
+        ++slot;
+    }
 
-typedef struct
-{
-    unsigned int  numberOfRecords;
-    size_t        sizeOfRecord;
-    size_t        bufferSize;
-    char          buffer;
-}
-OS_ConfigServiceBackend_BackendMemLayout_t;
+    if (OS_CONFIG_BACKEND_MAX_OPEN_FILES == slot)
+    {
+        Debug_LOG_ERROR("no slot left to open %s, %u files are open already",
+                        name.buffer, OS_CONFIG_BACKEND_MAX_OPEN_FILES);
+        return OS_ERROR_INSUFFICIENT_SPACE;
+    }
 
-/* Exported functions --------------------------------------------------------*/
-static OS_Error_t
-writeRecord_backend_memory(
-    OS_ConfigServiceBackend_t*   instance,
-    unsigned int         recordIndex,
-    const void*          buf,
-    size_t               bufSize)
-{
-    OS_ConfigServiceBackend_BackendMemLayout_t* memLayout =
-        (OS_ConfigServiceBackend_BackendMemLayout_t*)(instance->backend.memory.buffer);
-    char* record = &memLayout->buffer + instance->sizeOfRecord * recordIndex;
-    memcpy(record, buf, instance->sizeOfRecord);
+    OS_Error_t err = OS_ConfigServiceBackend_openBackendFile(
+                         instance,
+                         name,
+                         hFs,
+                         &openFiles[slot].file);
+    if (OS_SUCCESS != err)
+    {
+        return err;
+    }
+
+    openFiles[slot].isUsed = true;
+    instance->backend.fileSystem.slot = slot;
 
     return OS_SUCCESS;
 }
 
 //------------------------------------------------------------------------------
-static OS_Error_t
-readRecord_backend_memory(
-    OS_ConfigServiceBackend_t*   instance,
-    unsigned int         recordIndex,
-    void*                buf,
-    size_t               bufSize)
+OS_Error_t
+OS_ConfigServiceBackend_initializeJournaledFileBackend(
+    OS_ConfigServiceBackend_t*          instance,
+    OS_ConfigServiceBackend_FileName_t  name,
+    OS_FileSystem_Handle_t              hFs,
+    OS_ConfigServiceJournal_t*          journal)
 {
-    OS_ConfigServiceBackend_BackendMemLayout_t* memLayout =
-        (OS_ConfigServiceBackend_BackendMemLayout_t*)(instance->backend.memory.buffer);
-    char* record = &memLayout->buffer + instance->sizeOfRecord * recordIndex;
-    memcpy(buf, record, instance->sizeOfRecord);
+    OS_ConfigServiceBackend_File_t file;
+
+    OS_Error_t err = OS_ConfigServiceBackend_openBackendFile(
+                         instance,
+                         name,
+                         hFs,
+                         &file);
+    if (OS_SUCCESS != err)
+    {
+        return err;
+    }
+
+    // From now on the journal holds the file.
+    err = OS_ConfigServiceJournal_attach(
+              journal,
+              &file,
+              &instance->backend.fileSystem.slot);
+    if (OS_SUCCESS != err)
+    {
+        OS_ConfigServiceBackend_closeFile(hFs, file.hFile);
+        return err;
+    }
+
+    instance->backend.fileSystem.journal = journal;
 
     return OS_SUCCESS;
 }
 
 //------------------------------------------------------------------------------
 OS_Error_t
-OS_ConfigServiceBackend_createMemBackend(
-    void*         buffer,
-    size_t        bufferSize,
-    unsigned int  numberOfRecords,
-    size_t        sizeOfRecord)
+OS_ConfigServiceBackend_deinitializeFileBackend(
+    OS_ConfigServiceBackend_t*  instance)
 {
-    if (sizeof(OS_ConfigServiceBackend_BackendMemLayout_t) + numberOfRecords*
-        sizeOfRecord
-        <= bufferSize)
+    if (&OS_ConfigServiceBackend_fileOps != instance->ops)
     {
-        OS_ConfigServiceBackend_BackendMemLayout_t* memLayout =
-            (OS_ConfigServiceBackend_BackendMemLayout_t*)buffer;
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
 
-        memLayout->numberOfRecords = numberOfRecords;
-        memLayout->sizeOfRecord = sizeOfRecord;
-        memLayout->bufferSize = bufferSize;
+    return OS_ConfigServiceBackend_deinitialize(instance);
+}
+
+//------------------------------------------------------------------------------
+static OS_Error_t
+deinit_backend_filesystem(
+    OS_ConfigServiceBackend_t*  instance)
+{
+    OS_ConfigServiceBackend_File_t* file =
+        OS_ConfigServiceBackend_getFile(instance);
+
+    // Another copy of the backend object was deinitialized already.
+    if (NULL == file)
+    {
+        return OS_SUCCESS;
+    }
+
+    OS_ConfigServiceJournal_t* journal = instance->backend.fileSystem.journal;
+    if (NULL != journal)
+    {
+        OS_Error_t err = OS_ConfigServiceBackend_commitJournal(journal);
+        if (OS_SUCCESS != err)
+        {
+            return err;
+        }
+    }
+
+    OS_Error_t err = OS_SUCCESS;
+
+    // Nothing to close if a commit failed to re-open the file.
+    if (file->isOpen)
+    {
+        file->isOpen = false;
+        err = OS_ConfigServiceBackend_closeFile(file->hFs, file->hFile);
+    }
+
+    if (NULL != journal)
+    {
+        OS_ConfigServiceJournal_detach(
+            journal,
+            instance->backend.fileSystem.slot);
+    }
+    else
+    {
+        openFiles[instance->backend.fileSystem.slot].isUsed = false;
+    }
+
+    return err;
+}
+
+//------------------------------------------------------------------------------
+// The filesystem only guarantees that written data is committed to the
+// storage once the file is closed, so we close and re-open the file handle.
+// If re-opening fails, the file is marked as closed, so the stale handle is
+// not used anymore.
+static OS_Error_t
+OS_ConfigServiceBackend_commitFile(
+    OS_ConfigServiceBackend_File_t*  file)
+{
+    if (!file->isOpen)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    OS_Error_t err = OS_ConfigServiceBackend_closeFile(file->hFs, file->hFile);
+    if (OS_SUCCESS != err)
+    {
+        return err;
+    }
+
+    file->isOpen = false;
+
+    err = OS_ConfigServiceBackend_openFile(
+              file->hFs,
+              file->name.buffer,
+              &file->hFile);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_ERROR("re-opening %s failed, backend is unusable",
+                        file->name.buffer);
+        return err;
+    }
+
+    file->isOpen = true;
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Once the journal file is committed, the records are written to the backend
+// files. If this gets interrupted, the journal is replayed on the next start.
+static OS_Error_t
+OS_ConfigServiceBackend_commitJournal(
+    OS_ConfigServiceJournal_t*  journal)
+{
+    if (OS_ConfigServiceJournal_isEmpty(journal))
+    {
+        return OS_SUCCESS;
+    }
+
+    OS_Error_t err = OS_ConfigServiceJournal_write(journal);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_ERROR("OS_ConfigServiceJournal_write() failed with: %d", err);
+        return err;
+    }
+
+    size_t position = 0;
+    OS_ConfigServiceJournal_Entry_t const* entry;
+
+    while (NULL != (entry = OS_ConfigServiceJournal_getEntry(
+                                journal,
+                                position,
+                                &position)))
+    {
+        for (unsigned int k = 0; k < OS_CONFIG_SERVICE_JOURNAL_MAX_BACKENDS; ++k)
+        {
+            OS_ConfigServiceBackend_File_t* file =
+                OS_ConfigServiceJournal_getFile(journal, k);
+
+            if ((NULL == file) ||
+                (0 != strncmp(entry->fileName,
+                              file->name.buffer,
+                              OS_CONFIG_BACKEND_MAX_FILE_NAME_SIZE)))
+            {
+                continue;
+            }
+
+            if (!file->isOpen)
+            {
+                Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+                return OS_ERROR_INVALID_STATE;
+            }
+
+            err = OS_ConfigServiceBackend_writeToFile(
+                      file->hFs,
+                      file->hFile,
+                      entry->offset,
+                      entry + 1,
+                      entry->size);
+            if (OS_SUCCESS != err)
+            {
+                return err;
+            }
+        }
+    }
+
+    for (unsigned int k = 0; k < OS_CONFIG_SERVICE_JOURNAL_MAX_BACKENDS; ++k)
+    {
+        OS_ConfigServiceBackend_File_t* file =
+            OS_ConfigServiceJournal_getFile(journal, k);
+        if (NULL == file)
+        {
+            continue;
+        }
+
+        err = OS_ConfigServiceBackend_commitFile(file);
+        if (OS_SUCCESS != err)
+        {
+            return err;
+        }
+    }
+
+    return OS_ConfigServiceJournal_clear(journal);
+}
+
+//------------------------------------------------------------------------------
+static OS_Error_t
+flush_backend_filesystem(
+    OS_ConfigServiceBackend_t*  instance)
+{
+    if (NULL != instance->backend.fileSystem.journal)
+    {
+        return OS_ConfigServiceBackend_commitJournal(
+                   instance->backend.fileSystem.journal);
+    }
+
+    OS_ConfigServiceBackend_File_t* file =
+        OS_ConfigServiceBackend_getFile(instance);
+    if (NULL == file)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    return OS_ConfigServiceBackend_commitFile(file);
+}
+
+#endif // OS_CONFIG_SERVICE_BACKEND_FILESYSTEM
+
+
+//------------------------------------------------------------------------------
+// Memory Backend API
+//------------------------------------------------------------------------------
+
+#if defined(OS_CONFIG_SERVICE_BACKEND_MEMORY)
+
+typedef struct
+{
+    unsigned int  numberOfRecords;
+    size_t        sizeOfRecord;
+    size_t        bufferSize;
+    char          buffer;
+}
+OS_ConfigServiceBackend_BackendMemLayout_t;
+
+/* Exported functions --------------------------------------------------------*/
+static OS_Error_t
+writeRecord_backend_memory(
+    OS_ConfigServiceBackend_t*   instance,
+    unsigned int         recordIndex,
+    const void*          buf,
+    size_t               bufSize)
+{
+    OS_ConfigServiceBackend_BackendMemLayout_t* memLayout =
+        (OS_ConfigServiceBackend_BackendMemLayout_t*)(instance->backend.memory.buffer);
+    char* record = &memLayout->buffer + instance->sizeOfRecord * recordIndex;
+    memcpy(record, buf, bufSize);
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+static OS_Error_t
+readRecord_backend_memory(
+    OS_ConfigServiceBackend_t*   instance,
+    unsigned int         recordIndex,
+    void*                buf,
+    size_t               bufSize)
+{
+    OS_ConfigServiceBackend_BackendMemLayout_t* memLayout =
+        (OS_ConfigServiceBackend_BackendMemLayout_t*)(instance->backend.memory.buffer);
+    char* record = &memLayout->buffer + instance->sizeOfRecord * recordIndex;
+    memcpy(buf, record, bufSize);
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+static OS_Error_t
+getPointer_backend_memory(
+    OS_ConfigServiceBackend_t const*   instance,
+    unsigned int         firstIndex,
+    void const**         records)
+{
+    OS_ConfigServiceBackend_BackendMemLayout_t const* memLayout =
+        instance->backend.memory.buffer;
+    *records = &memLayout->buffer + instance->sizeOfRecord * firstIndex;
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Nothing to flush or release, the data is written to the buffer directly.
+static const OS_ConfigServiceBackend_Ops_t OS_ConfigServiceBackend_memOps =
+{
+    .read       = readRecord_backend_memory,
+    .write      = writeRecord_backend_memory,
+    .flush      = NULL,
+    .getPointer = getPointer_backend_memory,
+    .deinit     = NULL,
+};
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceBackend_createMemBackend(
+    void*         buffer,
+    size_t        bufferSize,
+    unsigned int  numberOfRecords,
+    size_t        sizeOfRecord)
+{
+    if (sizeof(OS_ConfigServiceBackend_BackendMemLayout_t) + numberOfRecords*
+        sizeOfRecord
+        <= bufferSize)
+    {
+        OS_ConfigServiceBackend_BackendMemLayout_t* memLayout =
+            (OS_ConfigServiceBackend_BackendMemLayout_t*)buffer;
+
+        memLayout->numberOfRecords = numberOfRecords;
+        memLayout->sizeOfRecord = sizeOfRecord;
+        memLayout->bufferSize = bufferSize;
 
         return OS_SUCCESS;
     }
@@ -426,7 +886,7 @@ OS_ConfigServiceBackend_initializeMemBackend(
     void*                buffer,
     size_t               bufferSize)
 {
-    instance->backendType = OS_CONFIG_BACKEND_BACKEND_TYPE_MEM;
+    instance->ops = &OS_ConfigServiceBackend_memOps;
 
     instance->backend.memory.buffer = buffer;
     instance->backend.memory.bufferSize = bufferSize;
@@ -436,6 +896,9 @@ OS_ConfigServiceBackend_initializeMemBackend(
     instance->numberOfRecords = memLayout->numberOfRecords;
     instance->sizeOfRecord = memLayout->sizeOfRecord;
 
+    instance->cache = NULL;
+    instance->mirror = NULL;
+
     return OS_SUCCESS;
 }
 
@@ -443,132 +906,1125 @@ OS_ConfigServiceBackend_initializeMemBackend(
 
 
 //------------------------------------------------------------------------------
-// Generic Function API
+// Memory Mapped File Backend API
 //------------------------------------------------------------------------------
 
-//------------------------------------------------------------------------------
-unsigned int
-OS_ConfigServiceBackend_getNumberOfRecords(
-    OS_ConfigServiceBackend_t const*   instance)
+#if defined(OS_CONFIG_SERVICE_BACKEND_MMAP)
+
+// Same layout as OS_ConfigServiceBackend_BackendFsLayout_t, so files can be
+// exchanged with targets using a filesystem backend.
+typedef struct
 {
-    return instance->numberOfRecords;
+    uint32_t  numberOfRecords;
+    uint64_t  sizeOfRecord;
 }
+OS_ConfigServiceBackend_BackendMmapLayout_t;
 
-
-//------------------------------------------------------------------------------
-size_t
-OS_ConfigServiceBackend_getSizeOfRecords(
-    OS_ConfigServiceBackend_t const*   instance)
+/* Exported functions --------------------------------------------------------*/
+static OS_Error_t
+writeRecord_backend_mmap(
+    OS_ConfigServiceBackend_t*   instance,
+    unsigned int         recordIndex,
+    const void*          buf,
+    size_t               bufSize)
 {
-    return instance->sizeOfRecord;
-}
+    char* record = (char*)instance->backend.mappedFile.base +
+                   sizeof(OS_ConfigServiceBackend_BackendMmapLayout_t) +
+                   instance->sizeOfRecord * recordIndex;
+    memcpy(record, buf, bufSize);
 
+    return OS_SUCCESS;
+}
 
 //------------------------------------------------------------------------------
-OS_Error_t
-OS_ConfigServiceBackend_readRecord(
+static OS_Error_t
+readRecord_backend_mmap(
     OS_ConfigServiceBackend_t*   instance,
     unsigned int         recordIndex,
     void*                buf,
     size_t               bufSize)
 {
-    if (recordIndex >= instance->numberOfRecords)
+    char const* record = (char const*)instance->backend.mappedFile.base +
+                         sizeof(OS_ConfigServiceBackend_BackendMmapLayout_t) +
+                         instance->sizeOfRecord * recordIndex;
+    memcpy(buf, record, bufSize);
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+static OS_Error_t
+flush_backend_mmap(
+    OS_ConfigServiceBackend_t*  instance)
+{
+    if (0 != msync(instance->backend.mappedFile.base,
+                   instance->backend.mappedFile.size,
+                   MS_SYNC))
     {
-        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
-        return OS_ERROR_INVALID_PARAMETER;
+        Debug_LOG_ERROR("msync() failed with: %s", strerror(errno));
+        return OS_ERROR_IO;
     }
 
-    if (bufSize < instance->sizeOfRecord)
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+static OS_Error_t
+getPointer_backend_mmap(
+    OS_ConfigServiceBackend_t const*   instance,
+    unsigned int         firstIndex,
+    void const**         records)
+{
+    *records = (char const*)instance->backend.mappedFile.base +
+               sizeof(OS_ConfigServiceBackend_BackendMmapLayout_t) +
+               instance->sizeOfRecord * firstIndex;
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+static OS_Error_t
+deinit_backend_mmap(
+    OS_ConfigServiceBackend_t*  instance)
+{
+    OS_Error_t err = flush_backend_mmap(instance);
+    if (OS_SUCCESS != err)
     {
-        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
-        return OS_ERROR_INVALID_PARAMETER;
+        return err;
     }
 
-    switch (instance->backendType)
+    if (0 != munmap(instance->backend.mappedFile.base,
+                    instance->backend.mappedFile.size))
     {
+        Debug_LOG_ERROR("munmap() failed with: %s", strerror(errno));
+        return OS_ERROR_IO;
+    }
 
-#if defined(OS_CONFIG_SERVICE_BACKEND_FILESYSTEM)
+    instance->backend.mappedFile.base = NULL;
 
-    case OS_CONFIG_SERVICE_BACKEND_FILESYSTEM:
-        return readRecord_backend_filesystem(
-                   instance,
-                   recordIndex,
-                   buf,
-                   bufSize);
+    return OS_SUCCESS;
+}
 
-#endif // OS_CONFIG_SERVICE_BACKEND_FILESYSTEM)
+//------------------------------------------------------------------------------
+static const OS_ConfigServiceBackend_Ops_t OS_ConfigServiceBackend_mmapOps =
+{
+    .read       = readRecord_backend_mmap,
+    .write      = writeRecord_backend_mmap,
+    .flush      = flush_backend_mmap,
+    .getPointer = getPointer_backend_mmap,
+    .deinit     = deinit_backend_mmap,
+};
 
-#if defined(OS_CONFIG_SERVICE_BACKEND_MEMORY)
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceBackend_createMmapBackend(
+    char const*   path,
+    unsigned int  numberOfRecords,
+    size_t        sizeOfRecord)
+{
+    OS_ConfigServiceBackend_BackendMmapLayout_t layout =
+    {
+        .numberOfRecords = numberOfRecords,
+        .sizeOfRecord = sizeOfRecord
+    };
+    off_t fileSize = sizeof(layout) + (off_t)numberOfRecords * sizeOfRecord;
 
-    case OS_CONFIG_BACKEND_BACKEND_TYPE_MEM:
-        return readRecord_backend_memory(
-                   instance,
-                   recordIndex,
-                   buf,
-                   bufSize);
+    int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        Debug_LOG_ERROR("open() of %s failed with: %s", path, strerror(errno));
+        return OS_ERROR_ACCESS_DENIED;
+    }
 
-#endif // OS_CONFIG_SERVICE_BACKEND_MEMORY)
+    // The records are zero filled, as with the filesystem backend.
+    OS_Error_t err = OS_SUCCESS;
+    if ((0 != ftruncate(fd, fileSize)) ||
+        ((ssize_t)sizeof(layout) != pwrite(fd, &layout, sizeof(layout), 0)))
+    {
+        Debug_LOG_ERROR("writing %s failed with: %s", path, strerror(errno));
+        err = OS_ERROR_IO;
+    }
 
-    default:
-        break;
-    } // end switch (instance->backendType)
+    close(fd);
 
-    Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
-    return OS_ERROR_NOT_SUPPORTED;
+    return err;
 }
 
-
 //------------------------------------------------------------------------------
 OS_Error_t
-OS_ConfigServiceBackend_writeRecord(
-    OS_ConfigServiceBackend_t*   instance,
-    unsigned int         recordIndex,
-    const void*          buf,
-    size_t               bufSize)
+OS_ConfigServiceBackend_initializeMmapBackend(
+    OS_ConfigServiceBackend_t*  instance,
+    char const*                 path)
 {
-    if (recordIndex >= instance->numberOfRecords)
+    int fd = open(path, O_RDWR);
+    if (fd < 0)
     {
-        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
-        return OS_ERROR_INVALID_PARAMETER;
+        Debug_LOG_ERROR("open() of %s failed with: %s", path, strerror(errno));
+        return OS_ERROR_NOT_FOUND;
     }
 
-    if (bufSize != instance->sizeOfRecord)
+    struct stat st;
+    if ((0 != fstat(fd, &st)) ||
+        (st.st_size < (off_t)sizeof(OS_ConfigServiceBackend_BackendMmapLayout_t)))
     {
         Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
-        Debug_LOG_DEBUG("Error: bufSize: %zu - instance->sizeOfRecord: %zu\n",
-                        bufSize, instance->sizeOfRecord);
+        close(fd);
         return OS_ERROR_INVALID_PARAMETER;
     }
 
-    switch (instance->backendType)
-    {
+    void* base = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
 
-#if defined(OS_CONFIG_SERVICE_BACKEND_FILESYSTEM)
+    // The mapping stays valid when the file is closed.
+    close(fd);
 
-    case OS_CONFIG_BACKEND_BACKEND_TYPE_FS:
-        return writeRecord_backend_filesystem(
-                   instance,
+    if (MAP_FAILED == base)
+    {
+        Debug_LOG_ERROR("mmap() of %s failed with: %s", path, strerror(errno));
+        return OS_ERROR_IO;
+    }
+
+    OS_ConfigServiceBackend_BackendMmapLayout_t const* layout = base;
+
+    if ((0 == layout->sizeOfRecord) ||
+        ((st.st_size - sizeof(*layout)) / layout->sizeOfRecord <
+         layout->numberOfRecords))
+    {
+        Debug_LOG_ERROR("%s is too small for its backend layout", path);
+        munmap(base, st.st_size);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
+    instance->ops = &OS_ConfigServiceBackend_mmapOps;
+
+    instance->backend.mappedFile.base = base;
+    instance->backend.mappedFile.size = st.st_size;
+
+    instance->numberOfRecords = layout->numberOfRecords;
+    instance->sizeOfRecord = layout->sizeOfRecord;
+
+    instance->cache = NULL;
+    instance->mirror = NULL;
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceBackend_deinitializeMmapBackend(
+    OS_ConfigServiceBackend_t*  instance)
+{
+    if (&OS_ConfigServiceBackend_mmapOps != instance->ops)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
+    return OS_ConfigServiceBackend_deinitialize(instance);
+}
+
+#endif // OS_CONFIG_SERVICE_BACKEND_MMAP
+
+
+//------------------------------------------------------------------------------
+// POSIX File Backend API
+//------------------------------------------------------------------------------
+
+#if defined(OS_CONFIG_SERVICE_BACKEND_POSIX)
+
+// Same layout as OS_ConfigServiceBackend_BackendFsLayout_t, so files can be
+// exchanged with targets using a filesystem backend.
+typedef struct
+{
+    uint32_t  numberOfRecords;
+    uint64_t  sizeOfRecord;
+}
+OS_ConfigServiceBackend_BackendPosixLayout_t;
+
+/* Exported functions --------------------------------------------------------*/
+// pread() and pwrite() may transfer less than requested, so they are repeated
+// until all data is transferred.
+static OS_Error_t
+OS_ConfigServiceBackend_transferPosix(
+    int           fd,
+    off_t         offset,
+    void*         buf,
+    size_t        bufSize,
+    bool          isWrite)
+{
+    size_t done = 0;
+
+    while (done < bufSize)
+    {
+        ssize_t n = isWrite ?
+                    pwrite(fd, (char const*)buf + done, bufSize - done,
+                           offset + done) :
+                    pread(fd, (char*)buf + done, bufSize - done,
+                          offset + done);
+        if ((n < 0) && (EINTR == errno))
+        {
+            continue;
+        }
+
+        if (n <= 0)
+        {
+            Debug_LOG_ERROR("%s() failed with: %s", isWrite ? "pwrite" : "pread",
+                            (0 == n) ? "end of file" : strerror(errno));
+            return OS_ERROR_IO;
+        }
+
+        done += n;
+    }
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+static OS_Error_t
+writeRecord_backend_posix(
+    OS_ConfigServiceBackend_t*   instance,
+    unsigned int         recordIndex,
+    const void*          buf,
+    size_t               bufSize)
+{
+    off_t offset = sizeof(OS_ConfigServiceBackend_BackendPosixLayout_t) +
+                   (off_t)recordIndex * instance->sizeOfRecord;
+
+    return OS_ConfigServiceBackend_transferPosix(
+               instance->backend.posixFile.fd,
+               offset,
+               (void*)buf,
+               bufSize,
+               true);
+}
+
+//------------------------------------------------------------------------------
+static OS_Error_t
+readRecord_backend_posix(
+    OS_ConfigServiceBackend_t*   instance,
+    unsigned int         recordIndex,
+    void*                buf,
+    size_t               bufSize)
+{
+    off_t offset = sizeof(OS_ConfigServiceBackend_BackendPosixLayout_t) +
+                   (off_t)recordIndex * instance->sizeOfRecord;
+
+    return OS_ConfigServiceBackend_transferPosix(
+               instance->backend.posixFile.fd,
+               offset,
+               buf,
+               bufSize,
+               false);
+}
+
+//------------------------------------------------------------------------------
+static OS_Error_t
+flush_backend_posix(
+    OS_ConfigServiceBackend_t*  instance)
+{
+    if (0 != fsync(instance->backend.posixFile.fd))
+    {
+        Debug_LOG_ERROR("fsync() failed with: %s", strerror(errno));
+        return OS_ERROR_IO;
+    }
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+static OS_Error_t
+deinit_backend_posix(
+    OS_ConfigServiceBackend_t*  instance)
+{
+    OS_Error_t err = flush_backend_posix(instance);
+    if (OS_SUCCESS != err)
+    {
+        return err;
+    }
+
+    if (0 != close(instance->backend.posixFile.fd))
+    {
+        Debug_LOG_ERROR("close() failed with: %s", strerror(errno));
+        return OS_ERROR_IO;
+    }
+
+    instance->backend.posixFile.fd = -1;
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+static const OS_ConfigServiceBackend_Ops_t OS_ConfigServiceBackend_posixOps =
+{
+    .read       = readRecord_backend_posix,
+    .write      = writeRecord_backend_posix,
+    .flush      = flush_backend_posix,
+    .getPointer = NULL,
+    .deinit     = deinit_backend_posix,
+};
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceBackend_createPosixBackend(
+    char const*   path,
+    unsigned int  numberOfRecords,
+    size_t        sizeOfRecord)
+{
+    OS_ConfigServiceBackend_BackendPosixLayout_t layout =
+    {
+        .numberOfRecords = numberOfRecords,
+        .sizeOfRecord = sizeOfRecord
+    };
+    off_t fileSize = sizeof(layout) + (off_t)numberOfRecords * sizeOfRecord;
+
+    int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        Debug_LOG_ERROR("open() of %s failed with: %s", path, strerror(errno));
+        return OS_ERROR_ACCESS_DENIED;
+    }
+
+    // The records are zero filled, as with the filesystem backend.
+    OS_Error_t err = OS_ERROR_IO;
+    if (0 != ftruncate(fd, fileSize))
+    {
+        Debug_LOG_ERROR("writing %s failed with: %s", path, strerror(errno));
+    }
+    else
+    {
+        err = OS_ConfigServiceBackend_transferPosix(
+                  fd,
+                  0,
+                  &layout,
+                  sizeof(layout),
+                  true);
+    }
+
+    close(fd);
+
+    return err;
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceBackend_initializePosixBackend(
+    OS_ConfigServiceBackend_t*  instance,
+    char const*                 path)
+{
+    int fd = open(path, O_RDWR);
+    if (fd < 0)
+    {
+        Debug_LOG_ERROR("open() of %s failed with: %s", path, strerror(errno));
+        return OS_ERROR_NOT_FOUND;
+    }
+
+    OS_ConfigServiceBackend_BackendPosixLayout_t layout;
+    struct stat st;
+
+    if ((0 != fstat(fd, &st)) ||
+        (st.st_size < (off_t)sizeof(layout)) ||
+        (OS_SUCCESS != OS_ConfigServiceBackend_transferPosix(
+             fd,
+             0,
+             &layout,
+             sizeof(layout),
+             false)))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        close(fd);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
+    if ((0 == layout.sizeOfRecord) ||
+        ((st.st_size - sizeof(layout)) / layout.sizeOfRecord <
+         layout.numberOfRecords))
+    {
+        Debug_LOG_ERROR("%s is too small for its backend layout", path);
+        close(fd);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
+    instance->ops = &OS_ConfigServiceBackend_posixOps;
+
+    instance->backend.posixFile.fd = fd;
+
+    instance->numberOfRecords = layout.numberOfRecords;
+    instance->sizeOfRecord = layout.sizeOfRecord;
+
+    instance->cache = NULL;
+    instance->mirror = NULL;
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceBackend_deinitializePosixBackend(
+    OS_ConfigServiceBackend_t*  instance)
+{
+    if (&OS_ConfigServiceBackend_posixOps != instance->ops)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
+    return OS_ConfigServiceBackend_deinitialize(instance);
+}
+
+#endif // OS_CONFIG_SERVICE_BACKEND_POSIX
+
+
+//------------------------------------------------------------------------------
+// Custom Backend API
+//------------------------------------------------------------------------------
+
+OS_Error_t
+OS_ConfigServiceBackend_initializeCustomBackend(
+    OS_ConfigServiceBackend_t*            instance,
+    OS_ConfigServiceBackend_Ops_t const*  ops,
+    void*                                 context,
+    unsigned int                          numberOfRecords,
+    size_t                                sizeOfRecord)
+{
+    if ((NULL == ops) || (NULL == ops->read) || (NULL == ops->write) ||
+        (0 == sizeOfRecord))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
+    instance->ops = ops;
+
+    instance->backend.context = context;
+
+    instance->numberOfRecords = numberOfRecords;
+    instance->sizeOfRecord = sizeOfRecord;
+
+    instance->cache = NULL;
+    instance->mirror = NULL;
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+void*
+OS_ConfigServiceBackend_getContext(
+    OS_ConfigServiceBackend_t const*   instance)
+{
+    return instance->backend.context;
+}
+
+
+//------------------------------------------------------------------------------
+// Generic Function API
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+unsigned int
+OS_ConfigServiceBackend_getNumberOfRecords(
+    OS_ConfigServiceBackend_t const*   instance)
+{
+    return instance->numberOfRecords;
+}
+
+
+//------------------------------------------------------------------------------
+size_t
+OS_ConfigServiceBackend_getSizeOfRecords(
+    OS_ConfigServiceBackend_t const*   instance)
+{
+    return instance->sizeOfRecord;
+}
+
+
+//------------------------------------------------------------------------------
+// The raw functions access bufSize bytes starting at the given record, which
+// can span several consecutive records.
+static OS_Error_t
+OS_ConfigServiceBackend_readRecordRaw(
+    OS_ConfigServiceBackend_t*   instance,
+    unsigned int         recordIndex,
+    void*                buf,
+    size_t               bufSize)
+{
+    return instance->ops->read(instance, recordIndex, buf, bufSize);
+}
+
+//------------------------------------------------------------------------------
+static OS_Error_t
+OS_ConfigServiceBackend_writeRecordRaw(
+    OS_ConfigServiceBackend_t*   instance,
+    unsigned int         recordIndex,
+    const void*          buf,
+    size_t               bufSize)
+{
+    return instance->ops->write(instance, recordIndex, buf, bufSize);
+}
+
+//------------------------------------------------------------------------------
+// Returns a cache slot which can take a new record. If the slot holds a
+// modified record, it is written to the backend first.
+static OS_Error_t
+OS_ConfigServiceBackend_reserveCacheSlot(
+    OS_ConfigServiceBackend_t*   instance,
+    uint32_t*                    slot)
+{
+    OS_ConfigServiceBackendCache_t* cache = instance->cache;
+    uint32_t victim = OS_ConfigServiceBackendCache_getVictim(cache);
+
+    if (OS_ConfigServiceBackendCache_isDirty(cache, victim))
+    {
+        OS_Error_t err = OS_ConfigServiceBackend_writeRecordRaw(
+                             instance,
+                             OS_ConfigServiceBackendCache_getRecordIndex(cache, victim),
+                             OS_ConfigServiceBackendCache_getData(cache, victim),
+                             instance->sizeOfRecord);
+        if (OS_SUCCESS != err)
+        {
+            Debug_LOG_ERROR("writing back record failed with: %d", err);
+            return err;
+        }
+
+        OS_ConfigServiceBackendCache_markClean(cache, victim);
+    }
+
+    *slot = victim;
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+static OS_Error_t
+OS_ConfigServiceBackend_readRecordCached(
+    OS_ConfigServiceBackend_t*   instance,
+    unsigned int         recordIndex,
+    void*                buf)
+{
+    OS_ConfigServiceBackendCache_t* cache = instance->cache;
+    uint32_t slot = OS_ConfigServiceBackendCache_find(cache, recordIndex);
+
+    if (OS_CONFIG_BACKEND_CACHE_NO_SLOT == slot)
+    {
+        OS_Error_t err = OS_ConfigServiceBackend_reserveCacheSlot(instance, &slot);
+        if (OS_SUCCESS != err)
+        {
+            return err;
+        }
+
+        err = OS_ConfigServiceBackend_readRecordRaw(
+                  instance,
+                  recordIndex,
+                  OS_ConfigServiceBackendCache_getData(cache, slot),
+                  instance->sizeOfRecord);
+        if (OS_SUCCESS != err)
+        {
+            // The data of the slot is clobbered now, so drop the record it
+            // may still hold.
+            OS_ConfigServiceBackendCache_release(cache, slot);
+            return err;
+        }
+
+        OS_ConfigServiceBackendCache_assign(cache, slot, recordIndex);
+    }
+
+    memcpy(buf, OS_ConfigServiceBackendCache_getData(cache, slot),
+           instance->sizeOfRecord);
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+static OS_Error_t
+OS_ConfigServiceBackend_writeRecordCached(
+    OS_ConfigServiceBackend_t*   instance,
+    unsigned int         recordIndex,
+    const void*          buf)
+{
+    OS_ConfigServiceBackendCache_t* cache = instance->cache;
+    uint32_t slot = OS_ConfigServiceBackendCache_findForWrite(cache, recordIndex);
+
+    if (OS_CONFIG_BACKEND_CACHE_POLICY_WRITE_THROUGH ==
+        OS_ConfigServiceBackendCache_getPolicy(cache))
+    {
+        OS_Error_t err = OS_ConfigServiceBackend_writeRecordRaw(
+                             instance,
+                             recordIndex,
+                             buf,
+                             instance->sizeOfRecord);
+        if (OS_SUCCESS != err)
+        {
+            return err;
+        }
+
+        // Records are only cached on reads, but a cached copy must not get
+        // stale.
+        if (OS_CONFIG_BACKEND_CACHE_NO_SLOT != slot)
+        {
+            memcpy(OS_ConfigServiceBackendCache_getData(cache, slot), buf,
+                   instance->sizeOfRecord);
+        }
+
+        return OS_SUCCESS;
+    }
+
+    if (OS_CONFIG_BACKEND_CACHE_NO_SLOT == slot)
+    {
+        OS_Error_t err = OS_ConfigServiceBackend_reserveCacheSlot(instance, &slot);
+        if (OS_SUCCESS != err)
+        {
+            return err;
+        }
+
+        OS_ConfigServiceBackendCache_assign(cache, slot, recordIndex);
+    }
+
+    memcpy(OS_ConfigServiceBackendCache_getData(cache, slot), buf,
+           instance->sizeOfRecord);
+    OS_ConfigServiceBackendCache_markDirty(cache, slot);
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Writes all modified records held by the cache to the backend.
+static OS_Error_t
+OS_ConfigServiceBackend_writeBackCache(
+    OS_ConfigServiceBackend_t*   instance)
+{
+    OS_ConfigServiceBackendCache_t* cache = instance->cache;
+
+    if (NULL == cache)
+    {
+        return OS_SUCCESS;
+    }
+
+    for (uint32_t slot = OS_ConfigServiceBackendCache_getNextDirty(cache, 0);
+         OS_CONFIG_BACKEND_CACHE_NO_SLOT != slot;
+         slot = OS_ConfigServiceBackendCache_getNextDirty(cache, slot + 1))
+    {
+        OS_Error_t err = OS_ConfigServiceBackend_writeRecordRaw(
+                             instance,
+                             OS_ConfigServiceBackendCache_getRecordIndex(cache, slot),
+                             OS_ConfigServiceBackendCache_getData(cache, slot),
+                             instance->sizeOfRecord);
+        if (OS_SUCCESS != err)
+        {
+            Debug_LOG_ERROR("writing back record failed with: %d", err);
+            return err;
+        }
+
+        OS_ConfigServiceBackendCache_markClean(cache, slot);
+    }
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceBackend_attachCache(
+    OS_ConfigServiceBackend_t*             instance,
+    OS_ConfigServiceBackendCache_t*        cache,
+    OS_ConfigServiceBackendCache_Policy_t  policy,
+    void*                                  buffer,
+    size_t                                 bufferSize)
+{
+    if ((NULL != instance->cache) || (NULL != instance->mirror))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    OS_Error_t err = OS_ConfigServiceBackendCache_init(
+                         cache,
+                         policy,
+                         buffer,
+                         bufferSize,
+                         instance->sizeOfRecord);
+    if (OS_SUCCESS != err)
+    {
+        return err;
+    }
+
+    instance->cache = cache;
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+OS_ConfigServiceBackendCache_t*
+OS_ConfigServiceBackend_getCache(
+    OS_ConfigServiceBackend_t const*   instance)
+{
+    return instance->cache;
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceBackend_attachMirror(
+    OS_ConfigServiceBackend_t*   instance,
+    void*                        buffer,
+    size_t                       bufferSize)
+{
+    if ((NULL != instance->cache) || (NULL != instance->mirror))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    if (bufferSize < OS_ConfigServiceBackend_getMirrorSize(instance))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    unsigned int recordsPerRead = OS_CONFIG_BACKEND_MIRROR_READ_SIZE /
+                                  instance->sizeOfRecord;
+    if (0 == recordsPerRead)
+    {
+        recordsPerRead = 1;
+    }
+
+    for (unsigned int first = 0; first < instance->numberOfRecords;
+         first += recordsPerRead)
+    {
+        unsigned int count = instance->numberOfRecords - first;
+        if (count > recordsPerRead)
+        {
+            count = recordsPerRead;
+        }
+
+        OS_Error_t err = OS_ConfigServiceBackend_readRecordRaw(
+                             instance,
+                             first,
+                             (char*)buffer + first * instance->sizeOfRecord,
+                             count * instance->sizeOfRecord);
+        if (OS_SUCCESS != err)
+        {
+            Debug_LOG_ERROR("reading records into mirror failed with: %d", err);
+            return err;
+        }
+    }
+
+    instance->mirror = buffer;
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+size_t
+OS_ConfigServiceBackend_getMirrorSize(
+    OS_ConfigServiceBackend_t const*   instance)
+{
+    return (size_t)instance->numberOfRecords * instance->sizeOfRecord;
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceBackend_readRecord(
+    OS_ConfigServiceBackend_t*   instance,
+    unsigned int         recordIndex,
+    void*                buf,
+    size_t               bufSize)
+{
+    if (recordIndex >= instance->numberOfRecords)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
+    if (bufSize < instance->sizeOfRecord)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
+    if (NULL != instance->mirror)
+    {
+        memcpy(buf,
+               (char const*)instance->mirror + recordIndex * instance->sizeOfRecord,
+               instance->sizeOfRecord);
+        return OS_SUCCESS;
+    }
+
+    if (NULL != instance->cache)
+    {
+        return OS_ConfigServiceBackend_readRecordCached(
+                   instance,
                    recordIndex,
-                   buf,
-                   bufSize);
+                   buf);
+    }
+
+    return OS_ConfigServiceBackend_readRecordRaw(
+               instance,
+               recordIndex,
+               buf,
+               instance->sizeOfRecord);
+}
 
-#endif // OS_CONFIG_SERVICE_BACKEND_FILESYSTEM)
 
-#if defined(OS_CONFIG_SERVICE_BACKEND_MEMORY)
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceBackend_writeRecord(
+    OS_ConfigServiceBackend_t*   instance,
+    unsigned int         recordIndex,
+    const void*          buf,
+    size_t               bufSize)
+{
+    if (recordIndex >= instance->numberOfRecords)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
+    if (bufSize != instance->sizeOfRecord)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        Debug_LOG_DEBUG("Error: bufSize: %zu - instance->sizeOfRecord: %zu\n",
+                        bufSize, instance->sizeOfRecord);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
 
-    case OS_CONFIG_BACKEND_BACKEND_TYPE_MEM:
-        return writeRecord_backend_memory(
+    if (NULL != instance->cache)
+    {
+        return OS_ConfigServiceBackend_writeRecordCached(
                    instance,
                    recordIndex,
-                   buf,
-                   bufSize);
+                   buf);
+    }
+
+    OS_Error_t err = OS_ConfigServiceBackend_writeRecordRaw(
+                         instance,
+                         recordIndex,
+                         buf,
+                         bufSize);
+    if ((OS_SUCCESS == err) && (NULL != instance->mirror))
+    {
+        memcpy((char*)instance->mirror + recordIndex * instance->sizeOfRecord,
+               buf,
+               bufSize);
+    }
 
-#endif // OS_CONFIG_SERVICE_BACKEND_MEMORY)
+    return err;
+}
+
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceBackend_readRecords(
+    OS_ConfigServiceBackend_t*   instance,
+    unsigned int         firstIndex,
+    unsigned int         numberOfRecords,
+    void*                buf,
+    size_t               bufSize)
+{
+    if ((firstIndex > instance->numberOfRecords) ||
+        (numberOfRecords > instance->numberOfRecords - firstIndex))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
+    size_t size = numberOfRecords * instance->sizeOfRecord;
+
+    if (bufSize < size)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
+    if (0 == numberOfRecords)
+    {
+        return OS_SUCCESS;
+    }
+
+    if (NULL != instance->mirror)
+    {
+        memcpy(buf,
+               (char const*)instance->mirror + firstIndex * instance->sizeOfRecord,
+               size);
+        return OS_SUCCESS;
+    }
+
+    if (NULL != instance->cache)
+    {
+        // The cache holds single records, so they are taken one by one.
+        for (unsigned int k = 0; k < numberOfRecords; ++k)
+        {
+            OS_Error_t err = OS_ConfigServiceBackend_readRecordCached(
+                                 instance,
+                                 firstIndex + k,
+                                 (char*)buf + k * instance->sizeOfRecord);
+            if (OS_SUCCESS != err)
+            {
+                return err;
+            }
+        }
+
+        return OS_SUCCESS;
+    }
+
+    return OS_ConfigServiceBackend_readRecordRaw(
+               instance,
+               firstIndex,
+               buf,
+               size);
+}
+
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceBackend_writeRecords(
+    OS_ConfigServiceBackend_t*   instance,
+    unsigned int         firstIndex,
+    unsigned int         numberOfRecords,
+    const void*          buf,
+    size_t               bufSize)
+{
+    if ((firstIndex > instance->numberOfRecords) ||
+        (numberOfRecords > instance->numberOfRecords - firstIndex))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
+    if (bufSize != numberOfRecords * instance->sizeOfRecord)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
+    if (0 == numberOfRecords)
+    {
+        return OS_SUCCESS;
+    }
+
+    OS_ConfigServiceBackendCache_t* cache = instance->cache;
+
+    if ((NULL != cache) &&
+        (OS_CONFIG_BACKEND_CACHE_POLICY_WRITE_BACK ==
+         OS_ConfigServiceBackendCache_getPolicy(cache)))
+    {
+        for (unsigned int k = 0; k < numberOfRecords; ++k)
+        {
+            OS_Error_t err = OS_ConfigServiceBackend_writeRecordCached(
+                                 instance,
+                                 firstIndex + k,
+                                 (char const*)buf + k * instance->sizeOfRecord);
+            if (OS_SUCCESS != err)
+            {
+                return err;
+            }
+        }
+
+        return OS_SUCCESS;
+    }
+
+    OS_Error_t err = OS_ConfigServiceBackend_writeRecordRaw(
+                         instance,
+                         firstIndex,
+                         buf,
+                         bufSize);
+    if ((OS_SUCCESS == err) && (NULL != instance->mirror))
+    {
+        memcpy((char*)instance->mirror + firstIndex * instance->sizeOfRecord,
+               buf,
+               bufSize);
+    }
+
+    if ((OS_SUCCESS != err) || (NULL == cache))
+    {
+        return err;
+    }
+
+    // Write-through: cached copies must not get stale.
+    for (unsigned int k = 0; k < numberOfRecords; ++k)
+    {
+        uint32_t slot = OS_ConfigServiceBackendCache_findForWrite(
+                            cache,
+                            firstIndex + k);
+        if (OS_CONFIG_BACKEND_CACHE_NO_SLOT != slot)
+        {
+            memcpy(OS_ConfigServiceBackendCache_getData(cache, slot),
+                   (char const*)buf + k * instance->sizeOfRecord,
+                   instance->sizeOfRecord);
+        }
+    }
+
+    return OS_SUCCESS;
+}
+
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceBackend_getRecordPointer(
+    OS_ConfigServiceBackend_t const*   instance,
+    unsigned int         firstIndex,
+    unsigned int         numberOfRecords,
+    void const**         records)
+{
+    if ((firstIndex > instance->numberOfRecords) ||
+        (numberOfRecords > instance->numberOfRecords - firstIndex))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
+    if (NULL != instance->mirror)
+    {
+        *records = (char const*)instance->mirror +
+                   firstIndex * instance->sizeOfRecord;
+        return OS_SUCCESS;
+    }
+
+    if ((NULL != instance->cache) &&
+        (OS_CONFIG_BACKEND_CACHE_POLICY_WRITE_BACK ==
+         OS_ConfigServiceBackendCache_getPolicy(instance->cache)))
+    {
+        return OS_ERROR_NOT_SUPPORTED;
+    }
 
-    default:
-        break;
-    } // end switch (instance->backendType)
+    if (NULL == instance->ops->getPointer)
+    {
+        return OS_ERROR_NOT_SUPPORTED;
+    }
+
+    return instance->ops->getPointer(instance, firstIndex, records);
+}
+
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceBackend_flush(
+    OS_ConfigServiceBackend_t*   instance)
+{
+    OS_Error_t err = OS_ConfigServiceBackend_writeBackCache(instance);
+    if (OS_SUCCESS != err)
+    {
+        return err;
+    }
+
+    if (NULL == instance->ops->flush)
+    {
+        return OS_SUCCESS;
+    }
+
+    return instance->ops->flush(instance);
+}
+
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceBackend_deinitialize(
+    OS_ConfigServiceBackend_t*   instance)
+{
+    OS_Error_t err = OS_ConfigServiceBackend_writeBackCache(instance);
+    if (OS_SUCCESS != err)
+    {
+        return err;
+    }
+
+    if (NULL == instance->ops->deinit)
+    {
+        return OS_SUCCESS;
+    }
 
-    Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
-    return OS_ERROR_NOT_SUPPORTED;
+    return instance->ops->deinit(instance);
 }
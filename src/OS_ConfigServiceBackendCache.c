@@ -0,0 +1,432 @@
+/*
+ * Copyright (C) 2020-2024, HENSOLDT Cyber GmbH
+ * 
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * For commercial licensing, contact: info.cyber@hensoldt.net
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "lib_debug/Debug.h"
+#include "OS_ConfigServiceBackendCache.h"
+
+#include <string.h>
+
+/* Private functions ---------------------------------------------------------*/
+static
+uint32_t
+OS_ConfigServiceBackendCache_hash(
+    OS_ConfigServiceBackendCache_t const* cache,
+    unsigned int recordIndex)
+{
+    return recordIndex % cache->numberOfSlots;
+}
+
+//------------------------------------------------------------------------------
+static
+void
+OS_ConfigServiceBackendCache_lruUnlink(
+    OS_ConfigServiceBackendCache_t* cache,
+    uint32_t slot)
+{
+    OS_ConfigServiceBackendCache_Slot_t* s = &cache->slots[slot];
+
+    if (OS_CONFIG_BACKEND_CACHE_NO_SLOT != s->lruPrev)
+    {
+        cache->slots[s->lruPrev].lruNext = s->lruNext;
+    }
+    else
+    {
+        cache->lruHead = s->lruNext;
+    }
+
+    if (OS_CONFIG_BACKEND_CACHE_NO_SLOT != s->lruNext)
+    {
+        cache->slots[s->lruNext].lruPrev = s->lruPrev;
+    }
+    else
+    {
+        cache->lruTail = s->lruPrev;
+    }
+
+    s->lruPrev = OS_CONFIG_BACKEND_CACHE_NO_SLOT;
+    s->lruNext = OS_CONFIG_BACKEND_CACHE_NO_SLOT;
+}
+
+//------------------------------------------------------------------------------
+static
+void
+OS_ConfigServiceBackendCache_lruPushHead(
+    OS_ConfigServiceBackendCache_t* cache,
+    uint32_t slot)
+{
+    OS_ConfigServiceBackendCache_Slot_t* s = &cache->slots[slot];
+
+    s->lruPrev = OS_CONFIG_BACKEND_CACHE_NO_SLOT;
+    s->lruNext = cache->lruHead;
+
+    if (OS_CONFIG_BACKEND_CACHE_NO_SLOT != cache->lruHead)
+    {
+        cache->slots[cache->lruHead].lruPrev = slot;
+    }
+    else
+    {
+        cache->lruTail = slot;
+    }
+
+    cache->lruHead = slot;
+}
+
+//------------------------------------------------------------------------------
+// Unused slots are kept at the tail, so they are taken before a valid record
+// gets evicted.
+static
+void
+OS_ConfigServiceBackendCache_lruPushTail(
+    OS_ConfigServiceBackendCache_t* cache,
+    uint32_t slot)
+{
+    OS_ConfigServiceBackendCache_Slot_t* s = &cache->slots[slot];
+
+    s->lruPrev = cache->lruTail;
+    s->lruNext = OS_CONFIG_BACKEND_CACHE_NO_SLOT;
+
+    if (OS_CONFIG_BACKEND_CACHE_NO_SLOT != cache->lruTail)
+    {
+        cache->slots[cache->lruTail].lruNext = slot;
+    }
+    else
+    {
+        cache->lruHead = slot;
+    }
+
+    cache->lruTail = slot;
+}
+
+//------------------------------------------------------------------------------
+static
+void
+OS_ConfigServiceBackendCache_hashUnlink(
+    OS_ConfigServiceBackendCache_t* cache,
+    uint32_t slot)
+{
+    uint32_t* link = &cache->buckets[OS_ConfigServiceBackendCache_hash(
+                                         cache,
+                                         cache->slots[slot].recordIndex)];
+
+    while (OS_CONFIG_BACKEND_CACHE_NO_SLOT != *link)
+    {
+        if (slot == *link)
+        {
+            *link = cache->slots[slot].hashNext;
+            break;
+        }
+        link = &cache->slots[*link].hashNext;
+    }
+
+    cache->slots[slot].hashNext = OS_CONFIG_BACKEND_CACHE_NO_SLOT;
+}
+
+//------------------------------------------------------------------------------
+// Returns the slot holding the given record and makes it the most recently
+// used one, the lookup is not counted.
+static
+uint32_t
+OS_ConfigServiceBackendCache_lookup(
+    OS_ConfigServiceBackendCache_t* cache,
+    unsigned int recordIndex)
+{
+    uint32_t slot = cache->buckets[OS_ConfigServiceBackendCache_hash(
+                                       cache,
+                                       recordIndex)];
+
+    while (OS_CONFIG_BACKEND_CACHE_NO_SLOT != slot)
+    {
+        if (cache->slots[slot].recordIndex == recordIndex)
+        {
+            OS_ConfigServiceBackendCache_lruUnlink(cache, slot);
+            OS_ConfigServiceBackendCache_lruPushHead(cache, slot);
+            return slot;
+        }
+        slot = cache->slots[slot].hashNext;
+    }
+
+    return OS_CONFIG_BACKEND_CACHE_NO_SLOT;
+}
+
+/* Exported functions --------------------------------------------------------*/
+OS_Error_t
+OS_ConfigServiceBackendCache_init(
+    OS_ConfigServiceBackendCache_t*        cache,
+    OS_ConfigServiceBackendCache_Policy_t  policy,
+    void*                                  buffer,
+    size_t                                 bufferSize,
+    size_t                                 sizeOfRecord)
+{
+    if ((NULL == buffer) || (0 == sizeOfRecord))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
+    if ((OS_CONFIG_BACKEND_CACHE_POLICY_WRITE_THROUGH != policy) &&
+        (OS_CONFIG_BACKEND_CACHE_POLICY_WRITE_BACK != policy))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
+    // The management data is placed at the beginning of the buffer, so it has
+    // to be suitably aligned.
+    if (0 != ((uintptr_t)buffer % sizeof(uint32_t)))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
+    size_t sizeOfSlot = sizeof(OS_ConfigServiceBackendCache_Slot_t) +
+                        sizeof(uint32_t) +
+                        sizeOfRecord;
+    unsigned int numberOfSlots = bufferSize / sizeOfSlot;
+
+    if ((0 == numberOfSlots) || (numberOfSlots >= OS_CONFIG_BACKEND_CACHE_NO_SLOT))
+    {
+        Debug_LOG_ERROR("cache buffer of %zu bytes can't hold records of %zu bytes",
+                        bufferSize, sizeOfRecord);
+        return OS_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    cache->policy = policy;
+    cache->sizeOfRecord = sizeOfRecord;
+    cache->numberOfSlots = numberOfSlots;
+
+    cache->slots = (OS_ConfigServiceBackendCache_Slot_t*)buffer;
+    cache->buckets = (uint32_t*)&cache->slots[numberOfSlots];
+    cache->data = (char*)&cache->buckets[numberOfSlots];
+
+    cache->lruHead = OS_CONFIG_BACKEND_CACHE_NO_SLOT;
+    cache->lruTail = OS_CONFIG_BACKEND_CACHE_NO_SLOT;
+
+    for (uint32_t k = 0; k < numberOfSlots; ++k)
+    {
+        cache->buckets[k] = OS_CONFIG_BACKEND_CACHE_NO_SLOT;
+
+        cache->slots[k].recordIndex = 0;
+        cache->slots[k].hashNext = OS_CONFIG_BACKEND_CACHE_NO_SLOT;
+        cache->slots[k].isValid = false;
+        cache->slots[k].isDirty = false;
+        OS_ConfigServiceBackendCache_lruPushTail(cache, k);
+    }
+
+    OS_ConfigServiceBackendCache_resetStats(cache);
+
+    Debug_LOG_DEBUG("cache holds %u records of %zu bytes\n",
+                    numberOfSlots, sizeOfRecord);
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+uint32_t
+OS_ConfigServiceBackendCache_find(
+    OS_ConfigServiceBackendCache_t*  cache,
+    unsigned int                     recordIndex)
+{
+    uint32_t slot = OS_ConfigServiceBackendCache_lookup(cache, recordIndex);
+
+    if (OS_CONFIG_BACKEND_CACHE_NO_SLOT != slot)
+    {
+        cache->stats.hits++;
+    }
+    else
+    {
+        cache->stats.misses++;
+    }
+
+    return slot;
+}
+
+//------------------------------------------------------------------------------
+uint32_t
+OS_ConfigServiceBackendCache_findForWrite(
+    OS_ConfigServiceBackendCache_t*  cache,
+    unsigned int                     recordIndex)
+{
+    uint32_t slot = OS_ConfigServiceBackendCache_lookup(cache, recordIndex);
+
+    if (OS_CONFIG_BACKEND_CACHE_NO_SLOT != slot)
+    {
+        cache->stats.writeHits++;
+    }
+    else
+    {
+        cache->stats.writeMisses++;
+    }
+
+    return slot;
+}
+
+//------------------------------------------------------------------------------
+uint32_t
+OS_ConfigServiceBackendCache_getVictim(
+    OS_ConfigServiceBackendCache_t const*  cache)
+{
+    return cache->lruTail;
+}
+
+//------------------------------------------------------------------------------
+void
+OS_ConfigServiceBackendCache_assign(
+    OS_ConfigServiceBackendCache_t*  cache,
+    uint32_t                         slot,
+    unsigned int                     recordIndex)
+{
+    OS_ConfigServiceBackendCache_Slot_t* s = &cache->slots[slot];
+
+    if (s->isValid)
+    {
+        Debug_ASSERT(!s->isDirty);
+        cache->stats.evictions++;
+        OS_ConfigServiceBackendCache_hashUnlink(cache, slot);
+    }
+
+    uint32_t bucket = OS_ConfigServiceBackendCache_hash(cache, recordIndex);
+
+    s->recordIndex = recordIndex;
+    s->isValid = true;
+    s->isDirty = false;
+    s->hashNext = cache->buckets[bucket];
+    cache->buckets[bucket] = slot;
+
+    OS_ConfigServiceBackendCache_lruUnlink(cache, slot);
+    OS_ConfigServiceBackendCache_lruPushHead(cache, slot);
+}
+
+//------------------------------------------------------------------------------
+void
+OS_ConfigServiceBackendCache_invalidate(
+    OS_ConfigServiceBackendCache_t*  cache,
+    unsigned int                     recordIndex)
+{
+    uint32_t slot = cache->buckets[OS_ConfigServiceBackendCache_hash(
+                                       cache,
+                                       recordIndex)];
+
+    while (OS_CONFIG_BACKEND_CACHE_NO_SLOT != slot)
+    {
+        if (cache->slots[slot].recordIndex == recordIndex)
+        {
+            OS_ConfigServiceBackendCache_release(cache, slot);
+            return;
+        }
+        slot = cache->slots[slot].hashNext;
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+OS_ConfigServiceBackendCache_release(
+    OS_ConfigServiceBackendCache_t*  cache,
+    uint32_t                         slot)
+{
+    if (cache->slots[slot].isValid)
+    {
+        OS_ConfigServiceBackendCache_hashUnlink(cache, slot);
+    }
+
+    cache->slots[slot].isValid = false;
+    cache->slots[slot].isDirty = false;
+    OS_ConfigServiceBackendCache_lruUnlink(cache, slot);
+    OS_ConfigServiceBackendCache_lruPushTail(cache, slot);
+}
+
+//------------------------------------------------------------------------------
+uint32_t
+OS_ConfigServiceBackendCache_getNextDirty(
+    OS_ConfigServiceBackendCache_t const*  cache,
+    uint32_t                               slot)
+{
+    for (; slot < cache->numberOfSlots; ++slot)
+    {
+        if (cache->slots[slot].isDirty)
+        {
+            return slot;
+        }
+    }
+
+    return OS_CONFIG_BACKEND_CACHE_NO_SLOT;
+}
+
+//------------------------------------------------------------------------------
+void
+OS_ConfigServiceBackendCache_markDirty(
+    OS_ConfigServiceBackendCache_t*  cache,
+    uint32_t                         slot)
+{
+    cache->slots[slot].isDirty = true;
+}
+
+//------------------------------------------------------------------------------
+void
+OS_ConfigServiceBackendCache_markClean(
+    OS_ConfigServiceBackendCache_t*  cache,
+    uint32_t                         slot)
+{
+    if (cache->slots[slot].isDirty)
+    {
+        cache->slots[slot].isDirty = false;
+        cache->stats.writeBacks++;
+    }
+}
+
+//------------------------------------------------------------------------------
+bool
+OS_ConfigServiceBackendCache_isDirty(
+    OS_ConfigServiceBackendCache_t const*  cache,
+    uint32_t                               slot)
+{
+    return cache->slots[slot].isDirty;
+}
+
+//------------------------------------------------------------------------------
+unsigned int
+OS_ConfigServiceBackendCache_getRecordIndex(
+    OS_ConfigServiceBackendCache_t const*  cache,
+    uint32_t                               slot)
+{
+    return cache->slots[slot].recordIndex;
+}
+
+//------------------------------------------------------------------------------
+void*
+OS_ConfigServiceBackendCache_getData(
+    OS_ConfigServiceBackendCache_t const*  cache,
+    uint32_t                               slot)
+{
+    return cache->data + (size_t)slot * cache->sizeOfRecord;
+}
+
+//------------------------------------------------------------------------------
+OS_ConfigServiceBackendCache_Policy_t
+OS_ConfigServiceBackendCache_getPolicy(
+    OS_ConfigServiceBackendCache_t const*  cache)
+{
+    return cache->policy;
+}
+
+//------------------------------------------------------------------------------
+void
+OS_ConfigServiceBackendCache_getStats(
+    OS_ConfigServiceBackendCache_t const*  cache,
+    OS_ConfigServiceBackendCache_Stats_t*  stats)
+{
+    *stats = cache->stats;
+}
+
+//------------------------------------------------------------------------------
+void
+OS_ConfigServiceBackendCache_resetStats(
+    OS_ConfigServiceBackendCache_t*  cache)
+{
+    memset(&cache->stats, 0, sizeof(cache->stats));
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2020-2024, HENSOLDT Cyber GmbH
+ * 
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * For commercial licensing, contact: info.cyber@hensoldt.net
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "OS_ConfigServiceDedup.h"
+
+#include <string.h>
+
+/* Private functions ---------------------------------------------------------*/
+
+// FNV-1a, see http://www.isthe.com/chongo/tech/comp/fnv/
+enum
+{
+    FNV_PRIME = 16777619u,
+};
+
+/* Exported functions --------------------------------------------------------*/
+void
+OS_ConfigServiceDedup_init(
+    OS_ConfigServiceDedup_t* table)
+{
+    memset(table->entries, 0, sizeof(table->entries));
+}
+
+//------------------------------------------------------------------------------
+uint32_t
+OS_ConfigServiceDedup_hash(
+    uint32_t hash,
+    void const* data,
+    size_t size)
+{
+    unsigned char const* bytes = data;
+
+    for (size_t k = 0; k < size; ++k)
+    {
+        hash ^= bytes[k];
+        hash *= FNV_PRIME;
+    }
+
+    return hash;
+}
+
+//------------------------------------------------------------------------------
+bool
+OS_ConfigServiceDedup_lookup(
+    OS_ConfigServiceDedup_t const* table,
+    uint32_t hash,
+    size_t size,
+    OS_ConfigServiceDedup_Entry_t* entry)
+{
+    OS_ConfigServiceDedup_Entry_t const* slot =
+        &table->entries[hash % OS_CONFIG_SERVICE_DEDUP_MAX_VALUES];
+
+    if ((0 == slot->numberOfRecords) ||
+        (slot->hash != hash) ||
+        (slot->size != size))
+    {
+        return false;
+    }
+
+    *entry = *slot;
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+void
+OS_ConfigServiceDedup_insert(
+    OS_ConfigServiceDedup_t* table,
+    uint32_t hash,
+    size_t size,
+    uint32_t index,
+    uint32_t numberOfRecords)
+{
+    OS_ConfigServiceDedup_Entry_t* slot =
+        &table->entries[hash % OS_CONFIG_SERVICE_DEDUP_MAX_VALUES];
+
+    slot->hash = hash;
+    slot->size = size;
+    slot->index = index;
+    slot->numberOfRecords = numberOfRecords;
+}
@@ -0,0 +1,433 @@
+/*
+ * Copyright (C) 2020-2024, HENSOLDT Cyber GmbH
+ * 
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * For commercial licensing, contact: info.cyber@hensoldt.net
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "lib_debug/Debug.h"
+#include "OS_ConfigServiceExtentMap.h"
+
+#include <limits.h>
+#include <string.h>
+
+/* Private functions ---------------------------------------------------------*/
+// Clips the given run of records to the records covered by the map. Returns
+// false if nothing is left.
+static
+bool
+OS_ConfigServiceExtentMap_clip(
+    OS_ConfigServiceExtentMap_t const* map,
+    uint32_t firstIndex,
+    uint32_t* numberOfRecords)
+{
+    if (!map->isValid || (firstIndex >= map->numberOfRecords))
+    {
+        return false;
+    }
+
+    if (*numberOfRecords > map->numberOfRecords - firstIndex)
+    {
+        *numberOfRecords = map->numberOfRecords - firstIndex;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+static
+bool
+OS_ConfigServiceExtentMap_testBit(
+    uint64_t const* bitmap,
+    uint32_t recordIndex)
+{
+    return 0 != (bitmap[recordIndex / 64] & ((uint64_t)1 << (recordIndex % 64)));
+}
+
+//------------------------------------------------------------------------------
+static
+void
+OS_ConfigServiceExtentMap_setBit(
+    uint64_t* bitmap,
+    uint32_t recordIndex)
+{
+    bitmap[recordIndex / 64] |= (uint64_t)1 << (recordIndex % 64);
+}
+
+//------------------------------------------------------------------------------
+static
+void
+OS_ConfigServiceExtentMap_clearBit(
+    uint64_t* bitmap,
+    uint32_t recordIndex)
+{
+    bitmap[recordIndex / 64] &= ~((uint64_t)1 << (recordIndex % 64));
+}
+
+//------------------------------------------------------------------------------
+// Returns the position of the given record in the table of shared records, or
+// the position it would have to be inserted at.
+static
+unsigned int
+OS_ConfigServiceExtentMap_seekShared(
+    OS_ConfigServiceExtentMap_t const* map,
+    uint32_t recordIndex)
+{
+    unsigned int lower = 0;
+    unsigned int upper = map->numberOfSharedRecords;
+
+    while (lower < upper)
+    {
+        unsigned int middle = lower + (upper - lower) / 2;
+
+        if (map->sharedRecords[middle].index < recordIndex)
+        {
+            lower = middle + 1;
+        }
+        else
+        {
+            upper = middle;
+        }
+    }
+
+    return lower;
+}
+
+//------------------------------------------------------------------------------
+// Returns the count of the given shared record, NULL if it is saturated.
+static
+OS_ConfigServiceExtentMap_SharedRecord_t*
+OS_ConfigServiceExtentMap_findShared(
+    OS_ConfigServiceExtentMap_t* map,
+    uint32_t recordIndex)
+{
+    unsigned int position = OS_ConfigServiceExtentMap_seekShared(
+                                map,
+                                recordIndex);
+
+    if ((position < map->numberOfSharedRecords) &&
+        (map->sharedRecords[position].index == recordIndex))
+    {
+        return &map->sharedRecords[position];
+    }
+
+    return NULL;
+}
+
+//------------------------------------------------------------------------------
+// Returns false if the count of the record cannot be kept.
+static
+bool
+OS_ConfigServiceExtentMap_acquireRecord(
+    OS_ConfigServiceExtentMap_t* map,
+    uint32_t recordIndex)
+{
+    if (!OS_ConfigServiceExtentMap_testBit(map->used, recordIndex))
+    {
+        OS_ConfigServiceExtentMap_setBit(map->used, recordIndex);
+        map->numberOfFreeRecords--;
+        return true;
+    }
+
+    if (OS_ConfigServiceExtentMap_testBit(map->shared, recordIndex))
+    {
+        OS_ConfigServiceExtentMap_SharedRecord_t* sharedRecord =
+            OS_ConfigServiceExtentMap_findShared(map, recordIndex);
+
+        if (NULL == sharedRecord)
+        {
+            return false;
+        }
+
+        sharedRecord->references++;
+        return true;
+    }
+
+    // Without room for its count, the record saturates and sticks.
+    OS_ConfigServiceExtentMap_setBit(map->shared, recordIndex);
+
+    if (map->numberOfSharedRecords >= OS_CONFIG_SERVICE_EXTENT_MAP_MAX_SHARED_RECORDS)
+    {
+        return false;
+    }
+
+    unsigned int position = OS_ConfigServiceExtentMap_seekShared(
+                                map,
+                                recordIndex);
+
+    memmove(&map->sharedRecords[position + 1],
+            &map->sharedRecords[position],
+            (map->numberOfSharedRecords - position) * sizeof(map->sharedRecords[0]));
+    map->sharedRecords[position].index = recordIndex;
+    map->sharedRecords[position].references = 2;
+    map->numberOfSharedRecords++;
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+static
+void
+OS_ConfigServiceExtentMap_releaseRecord(
+    OS_ConfigServiceExtentMap_t* map,
+    uint32_t recordIndex)
+{
+    if (!OS_ConfigServiceExtentMap_testBit(map->used, recordIndex))
+    {
+        return;
+    }
+
+    if (!OS_ConfigServiceExtentMap_testBit(map->shared, recordIndex))
+    {
+        OS_ConfigServiceExtentMap_clearBit(map->used, recordIndex);
+        map->numberOfFreeRecords++;
+        return;
+    }
+
+    OS_ConfigServiceExtentMap_SharedRecord_t* sharedRecord =
+        OS_ConfigServiceExtentMap_findShared(map, recordIndex);
+
+    if ((NULL == sharedRecord) || (--sharedRecord->references > 1))
+    {
+        return;
+    }
+
+    unsigned int position = (unsigned int)(sharedRecord - map->sharedRecords);
+
+    map->numberOfSharedRecords--;
+    memmove(&map->sharedRecords[position],
+            &map->sharedRecords[position + 1],
+            (map->numberOfSharedRecords - position) * sizeof(map->sharedRecords[0]));
+    OS_ConfigServiceExtentMap_clearBit(map->shared, recordIndex);
+}
+
+/* Exported functions --------------------------------------------------------*/
+void
+OS_ConfigServiceExtentMap_init(
+    OS_ConfigServiceExtentMap_t* map,
+    unsigned int numberOfRecords)
+{
+    memset(map->used, 0, sizeof(map->used));
+    memset(map->shared, 0, sizeof(map->shared));
+    map->numberOfSharedRecords = 0;
+
+    map->isValid = (numberOfRecords <= OS_CONFIG_SERVICE_EXTENT_MAP_MAX_RECORDS);
+    map->numberOfRecords = map->isValid ? numberOfRecords : 0;
+    map->numberOfFreeRecords = map->numberOfRecords;
+}
+
+//------------------------------------------------------------------------------
+bool
+OS_ConfigServiceExtentMap_isValid(
+    OS_ConfigServiceExtentMap_t const* map)
+{
+    return map->isValid;
+}
+
+//------------------------------------------------------------------------------
+void
+OS_ConfigServiceExtentMap_acquire(
+    OS_ConfigServiceExtentMap_t* map,
+    uint32_t firstIndex,
+    uint32_t numberOfRecords)
+{
+    if (!OS_ConfigServiceExtentMap_clip(map, firstIndex, &numberOfRecords))
+    {
+        return;
+    }
+
+    bool isCounted = true;
+
+    for (uint32_t k = firstIndex; k < firstIndex + numberOfRecords; ++k)
+    {
+        isCounted &= OS_ConfigServiceExtentMap_acquireRecord(map, k);
+    }
+
+    if (!isCounted)
+    {
+        Debug_LOG_WARNING("too many shared records, records at %u are not freed again",
+                          firstIndex);
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+OS_ConfigServiceExtentMap_release(
+    OS_ConfigServiceExtentMap_t* map,
+    uint32_t firstIndex,
+    uint32_t numberOfRecords)
+{
+    if (!OS_ConfigServiceExtentMap_clip(map, firstIndex, &numberOfRecords))
+    {
+        return;
+    }
+
+    for (uint32_t k = firstIndex; k < firstIndex + numberOfRecords; ++k)
+    {
+        OS_ConfigServiceExtentMap_releaseRecord(map, k);
+    }
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceExtentMap_find(
+    OS_ConfigServiceExtentMap_t const* map,
+    uint32_t numberOfRecords,
+    uint32_t* firstIndex)
+{
+    if (!map->isValid)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    if ((0 == numberOfRecords) || (numberOfRecords > map->numberOfFreeRecords))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INSUFFICIENT_SPACE;
+    }
+
+    uint32_t runStart = 0;
+    uint32_t runLength = 0;
+    uint32_t k = 0;
+
+    while (k < map->numberOfRecords)
+    {
+        // Words without a free record are skipped as a whole.
+        if ((0 == k % 64) && (UINT64_MAX == map->used[k / 64]))
+        {
+            runLength = 0;
+            k += 64;
+            continue;
+        }
+
+        if (OS_ConfigServiceExtentMap_testBit(map->used, k))
+        {
+            runLength = 0;
+        }
+        else
+        {
+            if (0 == runLength)
+            {
+                runStart = k;
+            }
+
+            if (++runLength == numberOfRecords)
+            {
+                *firstIndex = runStart;
+                return OS_SUCCESS;
+            }
+        }
+
+        k++;
+    }
+
+    Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+    return OS_ERROR_INSUFFICIENT_SPACE;
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceExtentMap_allocate(
+    OS_ConfigServiceExtentMap_t* map,
+    uint32_t numberOfRecords,
+    uint32_t* firstIndex)
+{
+    OS_Error_t err = OS_ConfigServiceExtentMap_find(
+                         map,
+                         numberOfRecords,
+                         firstIndex);
+    if (OS_SUCCESS != err)
+    {
+        return err;
+    }
+
+    OS_ConfigServiceExtentMap_acquire(map, *firstIndex, numberOfRecords);
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+unsigned int
+OS_ConfigServiceExtentMap_getReferences(
+    OS_ConfigServiceExtentMap_t const* map,
+    uint32_t recordIndex)
+{
+    if (!map->isValid || (recordIndex >= map->numberOfRecords) ||
+        !OS_ConfigServiceExtentMap_testBit(map->used, recordIndex))
+    {
+        return 0;
+    }
+
+    if (!OS_ConfigServiceExtentMap_testBit(map->shared, recordIndex))
+    {
+        return 1;
+    }
+
+    unsigned int position = OS_ConfigServiceExtentMap_seekShared(
+                                map,
+                                recordIndex);
+
+    if ((position < map->numberOfSharedRecords) &&
+        (map->sharedRecords[position].index == recordIndex))
+    {
+        return map->sharedRecords[position].references;
+    }
+
+    return UINT_MAX;
+}
+
+//------------------------------------------------------------------------------
+bool
+OS_ConfigServiceExtentMap_isShared(
+    OS_ConfigServiceExtentMap_t const* map,
+    uint32_t firstIndex,
+    uint32_t numberOfRecords)
+{
+    if (!OS_ConfigServiceExtentMap_clip(map, firstIndex, &numberOfRecords))
+    {
+        return false;
+    }
+
+    for (uint32_t k = firstIndex; k < firstIndex + numberOfRecords; ++k)
+    {
+        if (OS_ConfigServiceExtentMap_testBit(map->shared, k))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------
+unsigned int
+OS_ConfigServiceExtentMap_getNumberOfFreeRecords(
+    OS_ConfigServiceExtentMap_t const* map)
+{
+    return map->numberOfFreeRecords;
+}
+
+//------------------------------------------------------------------------------
+uint32_t
+OS_ConfigServiceExtentMap_getEnd(
+    OS_ConfigServiceExtentMap_t const* map)
+{
+    uint32_t end = map->numberOfRecords;
+
+    while ((end > 0) && !OS_ConfigServiceExtentMap_testBit(map->used, end - 1))
+    {
+        // Words without a used record are skipped as a whole.
+        if ((0 == end % 64) && (0 == map->used[end / 64 - 1]))
+        {
+            end -= 64;
+            continue;
+        }
+
+        end--;
+    }
+
+    return end;
+}
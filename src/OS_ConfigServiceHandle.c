@@ -10,6 +10,7 @@
 #include <unistd.h>
 
 #include "OS_ConfigServiceHandle.h"
+#include "OS_ConfigServiceAppIdentifier.h"
 
 /* Exported functions --------------------------------------------------------*/
 void
@@ -30,9 +31,24 @@ void
 OS_ConfigServiceHandle_initLocalHandle(
     void* instance,
     OS_ConfigServiceHandle_t* handle)
+{
+    unsigned int id;
+    unsigned int maxId;
+
+    OS_ConfigServiceAppIdentifier_WhoAmI(&id, &maxId);
+    OS_ConfigServiceHandle_initLocalHandleForApp(instance, id, handle);
+}
+
+//------------------------------------------------------------------------------
+void
+OS_ConfigServiceHandle_initLocalHandleForApp(
+    void* instance,
+    unsigned int appId,
+    OS_ConfigServiceHandle_t* handle)
 {
     handle->handleKind = OS_CONFIG_HANDLE_KIND_LOCAL;
     handle->context.local.instance = instance;
+    handle->context.local.appId = appId;
 }
 
 //------------------------------------------------------------------------------
@@ -51,6 +67,14 @@ OS_ConfigServiceHandle_getLocalInstance(
     return handle.context.local.instance;
 }
 
+//------------------------------------------------------------------------------
+unsigned int
+OS_ConfigServiceHandle_getAppId(
+    OS_ConfigServiceHandle_t handle)
+{
+    return handle.context.local.appId;
+}
+
 //------------------------------------------------------------------------------
 intptr_t
 OS_ConfigServiceHandle_getClientContext(
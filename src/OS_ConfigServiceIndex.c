@@ -0,0 +1,471 @@
+/*
+ * Copyright (C) 2020-2024, HENSOLDT Cyber GmbH
+ * 
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * For commercial licensing, contact: info.cyber@hensoldt.net
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "lib_debug/Debug.h"
+#include "OS_ConfigServiceIndex.h"
+
+#include <string.h>
+
+/* Private functions ---------------------------------------------------------*/
+
+// FNV-1a, see http://www.isthe.com/chongo/tech/comp/fnv/
+enum
+{
+    FNV_OFFSET_BASIS = 2166136261u,
+    FNV_PRIME        = 16777619u,
+};
+
+static
+uint32_t
+OS_ConfigServiceIndex_hashBytes(
+    uint32_t hash,
+    void const* data,
+    size_t size)
+{
+    unsigned char const* bytes = data;
+
+    for (size_t k = 0; k < size; ++k)
+    {
+        hash ^= bytes[k];
+        hash *= FNV_PRIME;
+    }
+
+    return hash;
+}
+
+//------------------------------------------------------------------------------
+// Domain names are compared up to the null terminator.
+static
+uint32_t
+OS_ConfigServiceIndex_hashDomainName(
+    OS_ConfigServiceLibTypes_DomainName_t const* domainName)
+{
+    return OS_ConfigServiceIndex_hashBytes(
+               FNV_OFFSET_BASIS,
+               domainName->name,
+               strnlen(domainName->name, OS_CONFIG_LIB_DOMAIN_NAME_SIZE));
+}
+
+//------------------------------------------------------------------------------
+// Parameter names are compared as a whole.
+static
+uint32_t
+OS_ConfigServiceIndex_hashParameterName(
+    uint32_t domainIndex,
+    OS_ConfigServiceLibTypes_ParameterName_t const* parameterName)
+{
+    uint32_t hash = OS_ConfigServiceIndex_hashBytes(
+                        FNV_OFFSET_BASIS,
+                        &domainIndex,
+                        sizeof(domainIndex));
+
+    return OS_ConfigServiceIndex_hashBytes(
+               hash,
+               parameterName->name,
+               OS_CONFIG_LIB_PARAMETER_NAME_SIZE);
+}
+
+//------------------------------------------------------------------------------
+static
+OS_Error_t
+OS_ConfigServiceIndex_insert(
+    OS_ConfigServiceIndex_Slot_t* slots,
+    unsigned int numberOfSlots,
+    uint32_t key,
+    uint32_t recordIndex)
+{
+    uint32_t slot = key % numberOfSlots;
+
+    for (unsigned int probes = 0; probes < numberOfSlots; ++probes)
+    {
+        if (0 == slots[slot].entry)
+        {
+            slots[slot].key = key;
+            slots[slot].entry = recordIndex + 1;
+            return OS_SUCCESS;
+        }
+        slot = (slot + 1) % numberOfSlots;
+    }
+
+    return OS_ERROR_INSUFFICIENT_SPACE;
+}
+
+//------------------------------------------------------------------------------
+static
+bool
+OS_ConfigServiceIndex_next(
+    OS_ConfigServiceIndex_Slot_t const* slots,
+    unsigned int numberOfSlots,
+    OS_ConfigServiceIndex_Cursor_t* cursor,
+    uint32_t* recordIndex)
+{
+    while (cursor->probes < numberOfSlots)
+    {
+        OS_ConfigServiceIndex_Slot_t const* s = &slots[cursor->slot];
+
+        if (0 == s->entry)
+        {
+            // End of the probe sequence, there can't be further candidates.
+            cursor->probes = numberOfSlots;
+            return false;
+        }
+
+        cursor->slot = (cursor->slot + 1) % numberOfSlots;
+        cursor->probes++;
+
+        if (s->key == cursor->key)
+        {
+            *recordIndex = s->entry - 1;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* Exported functions --------------------------------------------------------*/
+void
+OS_ConfigServiceIndex_init(
+    OS_ConfigServiceIndex_t* index)
+{
+    memset(index, 0, sizeof(*index));
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceIndex_addDomain(
+    OS_ConfigServiceIndex_t* index,
+    OS_ConfigServiceLibTypes_DomainName_t const* domainName,
+    uint32_t domainIndex)
+{
+    if (index->numberOfDomains >= OS_CONFIG_SERVICE_INDEX_MAX_DOMAINS)
+    {
+        return OS_ERROR_INSUFFICIENT_SPACE;
+    }
+
+    if (domainIndex != index->numberOfDomains)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
+    OS_Error_t err = OS_ConfigServiceIndex_insert(
+                         index->domainSlots,
+                         OS_CONFIG_SERVICE_INDEX_DOMAIN_SLOTS,
+                         OS_ConfigServiceIndex_hashDomainName(domainName),
+                         domainIndex);
+    if (OS_SUCCESS == err)
+    {
+        index->numberOfDomains++;
+    }
+
+    return err;
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceIndex_addParameter(
+    OS_ConfigServiceIndex_t* index,
+    uint32_t domainIndex,
+    OS_ConfigServiceLibTypes_ParameterName_t const* parameterName,
+    uint32_t parameterIndex)
+{
+    if (index->numberOfParameters >= OS_CONFIG_SERVICE_INDEX_MAX_PARAMETERS)
+    {
+        return OS_ERROR_INSUFFICIENT_SPACE;
+    }
+
+    if (parameterIndex != index->numberOfParameters)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
+    OS_Error_t err = OS_ConfigServiceIndex_insert(
+                         index->parameterSlots,
+                         OS_CONFIG_SERVICE_INDEX_PARAMETER_SLOTS,
+                         OS_ConfigServiceIndex_hashParameterName(
+                             domainIndex,
+                             parameterName),
+                         parameterIndex);
+    if (OS_SUCCESS == err)
+    {
+        index->parameterPosition[parameterIndex] = domainIndex;
+        index->numberOfParameters++;
+    }
+
+    return err;
+}
+
+//------------------------------------------------------------------------------
+void
+OS_ConfigServiceIndex_setParameterAccess(
+    OS_ConfigServiceIndex_t* index,
+    uint32_t parameterIndex,
+    OS_ConfigServiceAccessRights_t const* readAccess)
+{
+    if (parameterIndex >= index->numberOfParameters)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return;
+    }
+
+    unsigned int word = parameterIndex / 64;
+    uint64_t bit = (uint64_t)1 << (parameterIndex % 64);
+
+    for (unsigned int appId = 0; appId < OS_CONFIG_ACCESS_RIGHTS_MAX_ENTRY; ++appId)
+    {
+        if (OS_ConfigServiceAccessRights_IsSet(readAccess, appId))
+        {
+            index->views[appId][word] |= bit;
+        }
+        else
+        {
+            index->views[appId][word] &= ~bit;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Counting sort of the parameters by their domain. Parameters referring to a
+// domain that does not exist are not part of any list.
+void
+OS_ConfigServiceIndex_complete(
+    OS_ConfigServiceIndex_t* index)
+{
+    unsigned int numberOfDomains = index->numberOfDomains;
+    uint32_t* start = index->domainStart;
+
+    memset(start, 0, sizeof(index->domainStart));
+
+    for (unsigned int k = 0; k < index->numberOfParameters; ++k)
+    {
+        uint32_t domainIndex = index->parameterPosition[k];
+        if (domainIndex < numberOfDomains)
+        {
+            start[domainIndex + 1]++;
+        }
+    }
+
+    for (unsigned int d = 0; d < numberOfDomains; ++d)
+    {
+        start[d + 1] += start[d];
+    }
+
+    // start[d] serves as fill level of domain d, afterwards it points to the
+    // end of the list and is shifted back below.
+    for (unsigned int k = 0; k < index->numberOfParameters; ++k)
+    {
+        uint32_t domainIndex = index->parameterPosition[k];
+        if (domainIndex < numberOfDomains)
+        {
+            uint32_t position = start[domainIndex]++;
+            index->domainParameters[position] = k;
+            index->parameterPosition[k] = position;
+        }
+        else
+        {
+            index->parameterPosition[k] = UINT32_MAX;
+        }
+    }
+
+    for (unsigned int d = numberOfDomains; d > 0; --d)
+    {
+        start[d] = start[d - 1];
+    }
+    start[0] = 0;
+
+    index->isValid = true;
+}
+
+//------------------------------------------------------------------------------
+bool
+OS_ConfigServiceIndex_isValid(
+    OS_ConfigServiceIndex_t const* index)
+{
+    return index->isValid;
+}
+
+//------------------------------------------------------------------------------
+void
+OS_ConfigServiceIndex_beginDomainLookup(
+    OS_ConfigServiceIndex_t const* index,
+    OS_ConfigServiceLibTypes_DomainName_t const* domainName,
+    OS_ConfigServiceIndex_Cursor_t* cursor)
+{
+    (void)index;
+
+    cursor->key = OS_ConfigServiceIndex_hashDomainName(domainName);
+    cursor->slot = cursor->key % OS_CONFIG_SERVICE_INDEX_DOMAIN_SLOTS;
+    cursor->probes = 0;
+}
+
+//------------------------------------------------------------------------------
+bool
+OS_ConfigServiceIndex_nextDomain(
+    OS_ConfigServiceIndex_t const* index,
+    OS_ConfigServiceIndex_Cursor_t* cursor,
+    uint32_t* domainIndex)
+{
+    return OS_ConfigServiceIndex_next(
+               index->domainSlots,
+               OS_CONFIG_SERVICE_INDEX_DOMAIN_SLOTS,
+               cursor,
+               domainIndex);
+}
+
+//------------------------------------------------------------------------------
+void
+OS_ConfigServiceIndex_beginParameterLookup(
+    OS_ConfigServiceIndex_t const* index,
+    uint32_t domainIndex,
+    OS_ConfigServiceLibTypes_ParameterName_t const* parameterName,
+    OS_ConfigServiceIndex_Cursor_t* cursor)
+{
+    (void)index;
+
+    cursor->key = OS_ConfigServiceIndex_hashParameterName(
+                      domainIndex,
+                      parameterName);
+    cursor->slot = cursor->key % OS_CONFIG_SERVICE_INDEX_PARAMETER_SLOTS;
+    cursor->probes = 0;
+}
+
+//------------------------------------------------------------------------------
+bool
+OS_ConfigServiceIndex_nextParameter(
+    OS_ConfigServiceIndex_t const* index,
+    OS_ConfigServiceIndex_Cursor_t* cursor,
+    uint32_t* parameterIndex)
+{
+    return OS_ConfigServiceIndex_next(
+               index->parameterSlots,
+               OS_CONFIG_SERVICE_INDEX_PARAMETER_SLOTS,
+               cursor,
+               parameterIndex);
+}
+
+//------------------------------------------------------------------------------
+bool
+OS_ConfigServiceIndex_seekDomainParameter(
+    OS_ConfigServiceIndex_t const* index,
+    uint32_t domainIndex,
+    uint32_t parameterIndex,
+    uint32_t* position)
+{
+    if (domainIndex >= index->numberOfDomains)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return false;
+    }
+
+    uint32_t begin = index->domainStart[domainIndex];
+    uint32_t end = index->domainStart[domainIndex + 1];
+
+    // Usually the given parameter is part of the domain, e.g. when an
+    // enumerator is incremented.
+    if (parameterIndex < index->numberOfParameters)
+    {
+        uint32_t pos = index->parameterPosition[parameterIndex];
+        if ((pos >= begin) && (pos < end))
+        {
+            *position = pos;
+            return true;
+        }
+    }
+
+    if ((begin == end) || (parameterIndex <= index->domainParameters[begin]))
+    {
+        *position = begin;
+        return true;
+    }
+
+    while (begin < end)
+    {
+        uint32_t middle = begin + (end - begin) / 2;
+
+        if (index->domainParameters[middle] < parameterIndex)
+        {
+            begin = middle + 1;
+        }
+        else
+        {
+            end = middle;
+        }
+    }
+
+    *position = begin;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+bool
+OS_ConfigServiceIndex_getDomainParameter(
+    OS_ConfigServiceIndex_t const* index,
+    uint32_t domainIndex,
+    uint32_t position,
+    uint32_t* parameterIndex)
+{
+    if ((domainIndex >= index->numberOfDomains) ||
+        (position >= index->domainStart[domainIndex + 1]))
+    {
+        return false;
+    }
+
+    *parameterIndex = index->domainParameters[position];
+    return true;
+}
+
+//------------------------------------------------------------------------------
+bool
+OS_ConfigServiceIndex_isParameterVisible(
+    OS_ConfigServiceIndex_t const* index,
+    uint32_t parameterIndex,
+    unsigned int appId)
+{
+    if ((appId >= OS_CONFIG_ACCESS_RIGHTS_MAX_ENTRY) ||
+        (parameterIndex >= index->numberOfParameters))
+    {
+        return false;
+    }
+
+    return 0 != (index->views[appId][parameterIndex / 64] &
+                 ((uint64_t)1 << (parameterIndex % 64)));
+}
+
+//------------------------------------------------------------------------------
+bool
+OS_ConfigServiceIndex_findVisibleDomainParameter(
+    OS_ConfigServiceIndex_t const* index,
+    uint32_t domainIndex,
+    unsigned int appId,
+    uint32_t* position,
+    uint32_t* parameterIndex)
+{
+    uint32_t pos = *position;
+    uint32_t candidate;
+
+    while (OS_ConfigServiceIndex_getDomainParameter(
+               index,
+               domainIndex,
+               pos,
+               &candidate))
+    {
+        if (OS_ConfigServiceIndex_isParameterVisible(index, candidate, appId))
+        {
+            *position = pos;
+            *parameterIndex = candidate;
+            return true;
+        }
+
+        pos++;
+    }
+
+    return false;
+}
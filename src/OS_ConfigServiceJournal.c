@@ -0,0 +1,525 @@
+/*
+ * Copyright (C) 2020-2024, HENSOLDT Cyber GmbH
+ * 
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * For commercial licensing, contact: info.cyber@hensoldt.net
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "lib_debug/Debug.h"
+#include "OS_ConfigServiceJournal.h"
+
+#include <string.h>
+
+#if defined(OS_CONFIG_SERVICE_BACKEND_FILESYSTEM)
+
+/* Private types/defines -----------------------------------------------------*/
+#define JOURNAL_MAGIC  0x4C4E524AU  // "JRNL"
+
+// The data of an entry is padded, so the next entry is aligned.
+#define JOURNAL_ALIGN(size)  (((size) + 3) & ~(size_t)3)
+
+/* Private functions ---------------------------------------------------------*/
+
+// FNV-1a, see http://www.isthe.com/chongo/tech/comp/fnv/
+static
+uint32_t
+OS_ConfigServiceJournal_checksum(
+    void const* data,
+    size_t size)
+{
+    unsigned char const* bytes = data;
+    uint32_t hash = 2166136261u;
+
+    for (size_t k = 0; k < size; ++k)
+    {
+        hash ^= bytes[k];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+//------------------------------------------------------------------------------
+static
+OS_ConfigServiceJournal_Header_t*
+OS_ConfigServiceJournal_getHeader(
+    OS_ConfigServiceJournal_t const* journal)
+{
+    return (OS_ConfigServiceJournal_Header_t*)journal->buffer;
+}
+
+//------------------------------------------------------------------------------
+static
+bool
+OS_ConfigServiceJournal_isSameFile(
+    OS_ConfigServiceJournal_Entry_t const* entry,
+    char const* fileName)
+{
+    return (0 == strncmp(entry->fileName, fileName,
+                         OS_CONFIG_BACKEND_MAX_FILE_NAME_SIZE));
+}
+
+//------------------------------------------------------------------------------
+static
+OS_Error_t
+OS_ConfigServiceJournal_writeFile(
+    OS_FileSystem_Handle_t hFs,
+    char const* name,
+    uint32_t offset,
+    void const* data,
+    size_t size)
+{
+    OS_FileSystemFile_Handle_t hFile;
+
+    OS_Error_t err = OS_FileSystemFile_open(
+                         hFs,
+                         &hFile,
+                         name,
+                         OS_FileSystem_OpenMode_RDWR,
+                         OS_FileSystem_OpenFlags_NONE);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_ERROR("OS_FileSystemFile_open() failed with: %d", err);
+        return err;
+    }
+
+    err = OS_FileSystemFile_write(hFs, hFile, (long)offset, (long)size, data);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_ERROR("OS_FileSystemFile_write() failed with: %d", err);
+        OS_FileSystemFile_close(hFs, hFile);
+        return err;
+    }
+
+    // Closing the file commits the data to the storage.
+    err = OS_FileSystemFile_close(hFs, hFile);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_ERROR("OS_FileSystemFile_close() failed with: %d", err);
+    }
+
+    return err;
+}
+
+//------------------------------------------------------------------------------
+// Reads the journal file into the buffer. Returns true if it holds a complete
+// update.
+static
+bool
+OS_ConfigServiceJournal_load(
+    OS_ConfigServiceJournal_t* journal)
+{
+    OS_ConfigServiceJournal_Header_t* header =
+        OS_ConfigServiceJournal_getHeader(journal);
+    OS_FileSystemFile_Handle_t hFile;
+    off_t fileSize;
+
+    if ((OS_SUCCESS != OS_FileSystemFile_getSize(
+             journal->hFs,
+             journal->name.buffer,
+             &fileSize)) ||
+        (fileSize < (off_t)sizeof(OS_ConfigServiceJournal_Header_t)))
+    {
+        return false;
+    }
+
+    if (OS_SUCCESS != OS_FileSystemFile_open(
+            journal->hFs,
+            &hFile,
+            journal->name.buffer,
+            OS_FileSystem_OpenMode_RDONLY,
+            OS_FileSystem_OpenFlags_NONE))
+    {
+        return false;
+    }
+
+    bool isComplete = false;
+
+    if ((OS_SUCCESS == OS_FileSystemFile_read(
+             journal->hFs,
+             hFile,
+             0,
+             sizeof(*header),
+             header)) &&
+        (JOURNAL_MAGIC == header->magic) &&
+        (header->size <= journal->bufferSize - sizeof(*header)) &&
+        (fileSize >= (off_t)(sizeof(*header) + header->size)) &&
+        (OS_SUCCESS == OS_FileSystemFile_read(
+             journal->hFs,
+             hFile,
+             sizeof(*header),
+             header->size,
+             journal->buffer + sizeof(*header))))
+    {
+        isComplete = (header->checksum == OS_ConfigServiceJournal_checksum(
+                          journal->buffer + sizeof(*header),
+                          header->size));
+    }
+
+    OS_FileSystemFile_close(journal->hFs, hFile);
+
+    if (isComplete)
+    {
+        journal->used = sizeof(*header) + header->size;
+    }
+
+    return isComplete;
+}
+
+//------------------------------------------------------------------------------
+// Completes an update that was interrupted after the journal file was written.
+static
+OS_Error_t
+OS_ConfigServiceJournal_replay(
+    OS_ConfigServiceJournal_t* journal)
+{
+    size_t position = 0;
+    OS_ConfigServiceJournal_Entry_t const* entry;
+
+    Debug_LOG_INFO("replaying journal %s", journal->name.buffer);
+
+    while (NULL != (entry = OS_ConfigServiceJournal_getEntry(
+                                journal,
+                                position,
+                                &position)))
+    {
+        char name[OS_CONFIG_BACKEND_MAX_FILE_NAME_SIZE];
+
+        memcpy(name, entry->fileName, sizeof(name));
+        name[sizeof(name) - 1] = '\0';
+
+        OS_Error_t err = OS_ConfigServiceJournal_writeFile(
+                             journal->hFs,
+                             name,
+                             entry->offset,
+                             entry + 1,
+                             entry->size);
+        if (OS_SUCCESS != err)
+        {
+            return err;
+        }
+    }
+
+    return OS_SUCCESS;
+}
+
+/* Exported functions --------------------------------------------------------*/
+OS_Error_t
+OS_ConfigServiceJournal_init(
+    OS_ConfigServiceJournal_t* journal,
+    OS_ConfigServiceBackend_FileName_t name,
+    OS_FileSystem_Handle_t hFs,
+    void* buffer,
+    size_t bufferSize)
+{
+    if ((0 != ((uintptr_t)buffer % sizeof(uint32_t))) ||
+        (bufferSize < sizeof(OS_ConfigServiceJournal_Header_t) +
+         sizeof(OS_ConfigServiceJournal_Entry_t)))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
+    memset(journal, 0, sizeof(*journal));
+
+    journal->name = name;
+    journal->hFs = hFs;
+    journal->buffer = buffer;
+    journal->bufferSize = bufferSize;
+    journal->used = sizeof(OS_ConfigServiceJournal_Header_t);
+
+    if (OS_ConfigServiceJournal_load(journal))
+    {
+        OS_Error_t err = OS_ConfigServiceJournal_replay(journal);
+        if (OS_SUCCESS != err)
+        {
+            Debug_LOG_ERROR("OS_ConfigServiceJournal_replay() failed with: %d", err);
+            return err;
+        }
+    }
+
+    // Also creates the journal file if it does not exist yet.
+    return OS_ConfigServiceJournal_clear(journal);
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceJournal_attach(
+    OS_ConfigServiceJournal_t* journal,
+    OS_ConfigServiceBackend_File_t const* file,
+    unsigned int* slot)
+{
+    for (unsigned int k = 0; k < OS_CONFIG_SERVICE_JOURNAL_MAX_BACKENDS; ++k)
+    {
+        if (!journal->slots[k].isAttached)
+        {
+            journal->slots[k].file = *file;
+            journal->slots[k].isAttached = true;
+            *slot = k;
+            return OS_SUCCESS;
+        }
+    }
+
+    Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+    return OS_ERROR_INSUFFICIENT_SPACE;
+}
+
+//------------------------------------------------------------------------------
+OS_ConfigServiceBackend_File_t*
+OS_ConfigServiceJournal_getFile(
+    OS_ConfigServiceJournal_t* journal,
+    unsigned int slot)
+{
+    if ((slot >= OS_CONFIG_SERVICE_JOURNAL_MAX_BACKENDS) ||
+        !journal->slots[slot].isAttached)
+    {
+        return NULL;
+    }
+
+    return &journal->slots[slot].file;
+}
+
+//------------------------------------------------------------------------------
+void
+OS_ConfigServiceJournal_detach(
+    OS_ConfigServiceJournal_t* journal,
+    unsigned int slot)
+{
+    if (slot < OS_CONFIG_SERVICE_JOURNAL_MAX_BACKENDS)
+    {
+        journal->slots[slot].isAttached = false;
+    }
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceJournal_add(
+    OS_ConfigServiceJournal_t* journal,
+    char const* fileName,
+    uint32_t offset,
+    void const* data,
+    size_t size)
+{
+    size_t position = 0;
+    OS_ConfigServiceJournal_Entry_t const* entry;
+    OS_ConfigServiceJournal_Entry_t const* match = NULL;
+
+    // Writing the same location again only replaces the data, unless a later
+    // entry overlaps it and would then overwrite the new data.
+    while (NULL != (entry = OS_ConfigServiceJournal_getEntry(
+                                journal,
+                                position,
+                                &position)))
+    {
+        if (!OS_ConfigServiceJournal_isSameFile(entry, fileName) ||
+            (entry->offset >= offset + size) ||
+            (entry->offset + entry->size <= offset))
+        {
+            continue;
+        }
+
+        match = ((entry->offset == offset) && (entry->size == size)) ?
+                entry : NULL;
+    }
+
+    if (NULL != match)
+    {
+        memcpy((void*)(match + 1), data, size);
+        return OS_SUCCESS;
+    }
+
+    size_t entrySize = sizeof(OS_ConfigServiceJournal_Entry_t) +
+                       JOURNAL_ALIGN(size);
+
+    if (entrySize > journal->bufferSize - journal->used)
+    {
+        return OS_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    OS_ConfigServiceJournal_Entry_t* newEntry =
+        (OS_ConfigServiceJournal_Entry_t*)(journal->buffer + journal->used);
+
+    memset(newEntry, 0, entrySize);
+    strncpy(newEntry->fileName, fileName, sizeof(newEntry->fileName) - 1);
+    newEntry->offset = offset;
+    newEntry->size = size;
+    memcpy(newEntry + 1, data, size);
+
+    journal->used += entrySize;
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+bool
+OS_ConfigServiceJournal_covers(
+    OS_ConfigServiceJournal_t const* journal,
+    char const* fileName,
+    uint32_t offset,
+    size_t size)
+{
+    size_t position = 0;
+    OS_ConfigServiceJournal_Entry_t const* entry;
+
+    while (NULL != (entry = OS_ConfigServiceJournal_getEntry(
+                                journal,
+                                position,
+                                &position)))
+    {
+        if (OS_ConfigServiceJournal_isSameFile(entry, fileName) &&
+            (entry->offset <= offset) &&
+            (entry->offset + entry->size >= offset + size))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------
+void
+OS_ConfigServiceJournal_overlay(
+    OS_ConfigServiceJournal_t const* journal,
+    char const* fileName,
+    uint32_t offset,
+    void* data,
+    size_t size)
+{
+    size_t position = 0;
+    OS_ConfigServiceJournal_Entry_t const* entry;
+
+    // Later entries are more recent, so they are applied last.
+    while (NULL != (entry = OS_ConfigServiceJournal_getEntry(
+                                journal,
+                                position,
+                                &position)))
+    {
+        if (!OS_ConfigServiceJournal_isSameFile(entry, fileName) ||
+            (entry->offset >= offset + size) ||
+            (entry->offset + entry->size <= offset))
+        {
+            continue;
+        }
+
+        uint32_t begin = (entry->offset > offset) ? entry->offset : offset;
+        uint32_t end = (entry->offset + entry->size < offset + size) ?
+                       (entry->offset + entry->size) : (offset + size);
+
+        memcpy((char*)data + (begin - offset),
+               (char const*)(entry + 1) + (begin - entry->offset),
+               end - begin);
+    }
+}
+
+//------------------------------------------------------------------------------
+bool
+OS_ConfigServiceJournal_isEmpty(
+    OS_ConfigServiceJournal_t const* journal)
+{
+    return (journal->used == sizeof(OS_ConfigServiceJournal_Header_t));
+}
+
+//------------------------------------------------------------------------------
+// The journal file is written with a single write call, the checksum tells
+// whether it made it to the storage completely.
+OS_Error_t
+OS_ConfigServiceJournal_write(
+    OS_ConfigServiceJournal_t* journal)
+{
+    OS_ConfigServiceJournal_Header_t* header =
+        OS_ConfigServiceJournal_getHeader(journal);
+    size_t numberOfEntries = 0;
+    size_t position = 0;
+
+    while (NULL != OS_ConfigServiceJournal_getEntry(
+               journal,
+               position,
+               &position))
+    {
+        numberOfEntries++;
+    }
+
+    header->magic = JOURNAL_MAGIC;
+    header->numberOfEntries = numberOfEntries;
+    header->size = journal->used - sizeof(*header);
+    header->checksum = OS_ConfigServiceJournal_checksum(
+                           journal->buffer + sizeof(*header),
+                           header->size);
+
+    return OS_ConfigServiceJournal_writeFile(
+               journal->hFs,
+               journal->name.buffer,
+               0,
+               journal->buffer,
+               journal->used);
+}
+
+//------------------------------------------------------------------------------
+OS_ConfigServiceJournal_Entry_t const*
+OS_ConfigServiceJournal_getEntry(
+    OS_ConfigServiceJournal_t const* journal,
+    size_t position,
+    size_t* nextPosition)
+{
+    if (0 == position)
+    {
+        position = sizeof(OS_ConfigServiceJournal_Header_t);
+    }
+
+    if (position + sizeof(OS_ConfigServiceJournal_Entry_t) > journal->used)
+    {
+        return NULL;
+    }
+
+    OS_ConfigServiceJournal_Entry_t const* entry =
+        (OS_ConfigServiceJournal_Entry_t const*)(journal->buffer + position);
+    size_t entrySize = sizeof(*entry) + JOURNAL_ALIGN(entry->size);
+
+    // Entries read from the journal file are not trusted.
+    if (entrySize > journal->used - position)
+    {
+        return NULL;
+    }
+
+    *nextPosition = position + entrySize;
+
+    return entry;
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceJournal_clear(
+    OS_ConfigServiceJournal_t* journal)
+{
+    OS_ConfigServiceJournal_Header_t header = {0};
+    OS_FileSystemFile_Handle_t hFile;
+
+    journal->used = sizeof(header);
+
+    OS_Error_t err = OS_FileSystemFile_open(
+                         journal->hFs,
+                         &hFile,
+                         journal->name.buffer,
+                         OS_FileSystem_OpenMode_RDWR,
+                         OS_FileSystem_OpenFlags_CREATE);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_ERROR("OS_FileSystemFile_open() failed with: %d", err);
+        return err;
+    }
+
+    err = OS_FileSystemFile_write(journal->hFs, hFile, 0, sizeof(header), &header);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_ERROR("OS_FileSystemFile_write() failed with: %d", err);
+        OS_FileSystemFile_close(journal->hFs, hFile);
+        return err;
+    }
+
+    return OS_FileSystemFile_close(journal->hFs, hFile);
+}
+
+#endif // OS_CONFIG_SERVICE_BACKEND_FILESYSTEM
@@ -10,12 +10,23 @@
 #include <memory.h>
 
 #include "OS_ConfigServiceLib.h"
-#include "OS_ConfigServiceAppIdentifier.h"
+#include "OS_ConfigServiceParameterRecord.h"
 #include "lib_debug/Debug.h"
 
 #define LOG_NOT_INITIALIZED(func)\
     Debug_LOG_ERROR("initialization failed or missing, fail call %s()", (func))
 
+// Records reserved for the value of a batch entry, see
+// OS_ConfigServiceLib_parameterSetValuesBatch().
+typedef struct
+{
+    size_t entry;
+    OS_ConfigServiceExtentMap_t* map;
+    uint32_t index;
+    uint32_t numberOfRecords;
+}
+OS_ConfigServiceLib_Reservation_t;
+
 /* Exported functions --------------------------------------------------------*/
 static
 OS_Error_t
@@ -56,31 +67,158 @@ OS_ConfigServiceLib_parameterEnumeratorRawIncrement(
 //------------------------------------------------------------------------------
 static
 bool
-OS_ConfigServiceLib_ParameterIsVisibleForMe(
-    OS_ConfigServiceLibTypes_Parameter_t const* parameter)
+OS_ConfigServiceLib_ParameterIsVisibleFor(
+    OS_ConfigServiceLibTypes_Parameter_t const* parameter,
+    unsigned int appId)
 {
-    unsigned int id;
-    unsigned int maxId;
-
-    OS_ConfigServiceAppIdentifier_WhoAmI(&id, &maxId);
     return (OS_ConfigServiceAccessRights_IsSet(
                 &parameter->readAccess,
-                id));
+                appId));
 }
 
 //------------------------------------------------------------------------------
 static
 bool
-OS_ConfigServiceLib_ParameterIsWriteableForMe(
-    OS_ConfigServiceLibTypes_Parameter_t const* parameter)
+OS_ConfigServiceLib_ParameterIsWriteableFor(
+    OS_ConfigServiceLibTypes_Parameter_t const* parameter,
+    unsigned int appId)
 {
-    unsigned int id;
-    unsigned int maxId;
-
-    OS_ConfigServiceAppIdentifier_WhoAmI(&id, &maxId);
     return (OS_ConfigServiceAccessRights_IsSet(
                 &parameter->writeAccess,
-                id));
+                appId));
+}
+
+//------------------------------------------------------------------------------
+// Parameter records are either stored as OS_ConfigServiceParameterRecordV1_t
+// or as OS_ConfigServiceParameterRecord_t (version 2), the record size of the
+// parameter backend tells which one.
+static
+bool
+OS_ConfigServiceLib_hasCompactParameters(
+    OS_ConfigServiceLib_t const* instance)
+{
+    return (sizeof(OS_ConfigServiceParameterRecord_t) ==
+            OS_ConfigServiceBackend_getSizeOfRecords(&instance->parameterBackend));
+}
+
+//------------------------------------------------------------------------------
+static
+OS_Error_t
+OS_ConfigServiceLib_readParameter(
+    OS_ConfigServiceLib_t* instance,
+    uint32_t parameterIndex,
+    OS_ConfigServiceLibTypes_Parameter_t* parameter)
+{
+    if (!OS_ConfigServiceLib_hasCompactParameters(instance))
+    {
+        OS_ConfigServiceParameterRecordV1_t v1Record;
+
+        OS_Error_t err = OS_ConfigServiceBackend_readRecord(
+                             &instance->parameterBackend,
+                             parameterIndex,
+                             &v1Record,
+                             sizeof(v1Record));
+        if (OS_SUCCESS != err)
+        {
+            return err;
+        }
+
+        OS_ConfigServiceParameterRecord_decodeV1(parameter, &v1Record);
+        parameter->index = parameterIndex;
+        return OS_SUCCESS;
+    }
+
+    OS_ConfigServiceParameterRecord_t record;
+
+    OS_Error_t err = OS_ConfigServiceBackend_readRecord(
+                         &instance->parameterBackend,
+                         parameterIndex,
+                         &record,
+                         sizeof(record));
+    if (OS_SUCCESS != err)
+    {
+        return err;
+    }
+
+    err = OS_ConfigServiceParameterRecord_decode(parameter, &record);
+    parameter->index = parameterIndex;
+
+    return err;
+}
+
+//------------------------------------------------------------------------------
+static
+OS_Error_t
+OS_ConfigServiceLib_writeParameter(
+    OS_ConfigServiceLib_t* instance,
+    uint32_t parameterIndex,
+    OS_ConfigServiceLibTypes_Parameter_t const* parameter)
+{
+    OS_Error_t err;
+
+    if (!OS_ConfigServiceLib_hasCompactParameters(instance))
+    {
+        OS_ConfigServiceParameterRecordV1_t v1Record;
+        OS_ConfigServiceParameterRecord_encodeV1(&v1Record, parameter);
+
+        err = OS_ConfigServiceBackend_writeRecord(
+                  &instance->parameterBackend,
+                  parameterIndex,
+                  &v1Record,
+                  sizeof(v1Record));
+    }
+    else
+    {
+        OS_ConfigServiceParameterRecord_t record;
+        OS_ConfigServiceParameterRecord_encode(&record, parameter);
+
+        err = OS_ConfigServiceBackend_writeRecord(
+                  &instance->parameterBackend,
+                  parameterIndex,
+                  &record,
+                  sizeof(record));
+    }
+
+    // Keep the views of the index in line with the stored access rights.
+    if ((OS_SUCCESS == err) && OS_ConfigServiceIndex_isValid(&instance->index))
+    {
+        OS_ConfigServiceIndex_setParameterAccess(
+            &instance->index,
+            parameterIndex,
+            &parameter->readAccess);
+    }
+
+    return err;
+}
+
+//------------------------------------------------------------------------------
+// Moves the given parameter enumerator to the first parameter visible for the
+// given app, starting at the given position in the parameter list of its
+// domain. The view of the app in the index tells which parameters are visible,
+// so no records are read.
+static
+OS_Error_t
+OS_ConfigServiceLib_findParamterInDomainList(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t* enumerator,
+    uint32_t position)
+{
+    uint32_t parameterIndex;
+
+    if (OS_ConfigServiceIndex_findVisibleDomainParameter(
+            &instance->index,
+            enumerator->domainEnumerator.index,
+            appId,
+            &position,
+            &parameterIndex))
+    {
+        enumerator->index = parameterIndex;
+        return OS_SUCCESS;
+    }
+
+    Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+    return OS_ERROR_GENERIC;
 }
 
 //------------------------------------------------------------------------------
@@ -90,8 +228,30 @@ static
 OS_Error_t
 OS_ConfigServiceLib_findParamter(
     OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
     OS_ConfigServiceLibTypes_ParameterEnumerator_t* enumerator)
 {
+    if (OS_ConfigServiceIndex_isValid(&instance->index))
+    {
+        uint32_t position;
+
+        if (!OS_ConfigServiceIndex_seekDomainParameter(
+                &instance->index,
+                enumerator->domainEnumerator.index,
+                enumerator->index,
+                &position))
+        {
+            Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+            return OS_ERROR_GENERIC;
+        }
+
+        return OS_ConfigServiceLib_findParamterInDomainList(
+                   instance,
+                   appId,
+                   enumerator,
+                   position);
+    }
+
     OS_ConfigServiceLibTypes_ParameterEnumerator_t searchEnumerator = *enumerator;
 
     for (;;)
@@ -99,20 +259,19 @@ OS_ConfigServiceLib_findParamter(
         OS_Error_t err;
 
         OS_ConfigServiceLibTypes_Parameter_t parameter = {0};
-        err = OS_ConfigServiceBackend_readRecord(
-                  &instance->parameterBackend,
+        err = OS_ConfigServiceLib_readParameter(
+                  instance,
                   searchEnumerator.index,
-                  &parameter,
-                  sizeof(OS_ConfigServiceLibTypes_Parameter_t));
+                  &parameter);
 
         if (OS_SUCCESS != err)
         {
-            Debug_LOG_ERROR("OS_ConfigServiceBackend_readRecord() failed, error %d", err);
+            Debug_LOG_ERROR("OS_ConfigServiceLib_readParameter() failed, error %d", err);
             return OS_ERROR_GENERIC;
         }
 
         if ((parameter.domain.index == searchEnumerator.domainEnumerator.index) &&
-            (OS_ConfigServiceLib_ParameterIsVisibleForMe(&parameter)))
+            (OS_ConfigServiceLib_ParameterIsVisibleFor(&parameter, appId)))
         {
             *enumerator = searchEnumerator;
             return OS_SUCCESS;
@@ -135,11 +294,13 @@ static
 OS_Error_t
 OS_ConfigServiceLib_advanceParameterEnumerator(
     OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
     OS_ConfigServiceLibTypes_ParameterEnumerator_t* searchEnumerator,
     OS_ConfigServiceLibTypes_ParameterEnumerator_t* resultEnumerator)
 {
     OS_Error_t findResult = OS_ConfigServiceLib_findParamter(
                                 instance,
+                                appId,
                                 searchEnumerator);
 
     if (OS_SUCCESS == findResult)
@@ -191,93 +352,219 @@ OS_ConfigServiceLib_compareDomainName(
 }
 
 //------------------------------------------------------------------------------
+// Returns true if the given range lies within the given records.
+static
+bool
+OS_ConfigServiceLib_isRangeInRecords(
+    OS_ConfigServiceBackend_t const* backend,
+    uint32_t numberOfRecords,
+    size_t offset,
+    size_t length)
+{
+    uint64_t capacity = (uint64_t)numberOfRecords *
+                        OS_ConfigServiceBackend_getSizeOfRecords(backend);
+
+    return (offset <= capacity) && (length <= capacity - offset);
+}
+
+//------------------------------------------------------------------------------
+// Reads the given range of a value that spans the given records. Completely
+// covered records go into the buffer with a single read, partially covered
+// ones are bounced.
 static
 OS_Error_t
-OS_ConfigServiceLib_fetchVariableLengthString(
+OS_ConfigServiceLib_readRecordRange(
     OS_ConfigServiceBackend_t* backend,
     uint32_t index,
-    size_t stringSize,
+    uint32_t numberOfRecords,
+    size_t offset,
     void* buffer,
-    size_t bufferSize)
+    size_t length)
 {
+    if (!OS_ConfigServiceLib_isRangeInRecords(
+            backend,
+            numberOfRecords,
+            offset,
+            length))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
     // We anticipate a maximum size here which should be ok to place on the stack.
-    char tmpBuf[OS_CONFIG_LIB_PARAMETER_MAX_STRING_SIZE];
+    char tmpBuf[OS_CONFIG_LIB_PARAMETER_MAX_BLOB_BLOCK_SIZE];
+    size_t recordSize = OS_ConfigServiceBackend_getSizeOfRecords(backend);
+    uint32_t record = index + offset / recordSize;
+    size_t recordOffset = offset % recordSize;
+    size_t bytesCopied = 0;
 
-    if (stringSize > bufferSize)
+    if (0 != recordOffset)
+    {
+        if (OS_SUCCESS != OS_ConfigServiceBackend_readRecord(
+                backend,
+                record,
+                tmpBuf,
+                sizeof(tmpBuf)))
+        {
+            Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+            return OS_ERROR_GENERIC;
+        }
+
+        bytesCopied = recordSize - recordOffset;
+        if (bytesCopied > length)
+        {
+            bytesCopied = length;
+        }
+
+        memcpy(buffer, tmpBuf + recordOffset, bytesCopied);
+        record++;
+    }
+
+    uint32_t fullRecords = (length - bytesCopied) / recordSize;
+
+    if (OS_SUCCESS != OS_ConfigServiceBackend_readRecords(
+            backend,
+            record,
+            fullRecords,
+            (char*)buffer + bytesCopied,
+            fullRecords * recordSize))
     {
         Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
         return OS_ERROR_GENERIC;
     }
 
-    OS_Error_t fetchResult = OS_ConfigServiceBackend_readRecord(
-                                 backend,
-                                 index,
-                                 tmpBuf,
-                                 sizeof(tmpBuf));
+    bytesCopied += fullRecords * recordSize;
+    record += fullRecords;
 
-    if (OS_SUCCESS == fetchResult)
+    if (bytesCopied < length)
     {
-        memcpy(buffer, tmpBuf, stringSize);
+        if (OS_SUCCESS != OS_ConfigServiceBackend_readRecord(
+                backend,
+                record,
+                tmpBuf,
+                sizeof(tmpBuf)))
+        {
+            Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+            return OS_ERROR_GENERIC;
+        }
+
+        memcpy((char*)buffer + bytesCopied, tmpBuf, length - bytesCopied);
     }
-    else
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Writes data into a part of a record, the rest of the record is kept.
+static
+OS_Error_t
+OS_ConfigServiceLib_patchRecord(
+    OS_ConfigServiceBackend_t* backend,
+    uint32_t record,
+    size_t recordOffset,
+    void const* data,
+    size_t size)
+{
+    // We anticipate a maximum size here which should be ok to place on the stack.
+    char tmpBuf[OS_CONFIG_LIB_PARAMETER_MAX_BLOB_BLOCK_SIZE];
+
+    OS_Error_t err = OS_ConfigServiceBackend_readRecord(
+                         backend,
+                         record,
+                         tmpBuf,
+                         sizeof(tmpBuf));
+    if (OS_SUCCESS != err)
     {
         Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return err;
     }
 
-    return fetchResult;
+    memcpy(tmpBuf + recordOffset, data, size);
+
+    return OS_ConfigServiceBackend_writeRecord(
+               backend,
+               record,
+               tmpBuf,
+               OS_ConfigServiceBackend_getSizeOfRecords(backend));
 }
 
 //------------------------------------------------------------------------------
+// Writes the given range of a value that spans the given records. Completely
+// covered records are written with a single write, partially covered ones keep
+// the data outside of the range.
 static
 OS_Error_t
-OS_ConfigServiceLib_fetchVariableLengthBlob(
+OS_ConfigServiceLib_writeRecordRange(
     OS_ConfigServiceBackend_t* backend,
-    size_t blobSize,
     uint32_t index,
-    uint32_t numberOfBlocks,
-    void* buffer,
-    size_t bufferSize)
+    uint32_t numberOfRecords,
+    size_t offset,
+    void const* buffer,
+    size_t length)
 {
-    if (blobSize > bufferSize)
+    if (!OS_ConfigServiceLib_isRangeInRecords(
+            backend,
+            numberOfRecords,
+            offset,
+            length))
     {
         Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
-        return OS_ERROR_GENERIC;
+        return OS_ERROR_INVALID_PARAMETER;
     }
 
-    // We anticipate a maximum size here which should be ok to place on the stack.
-    char tmpBuf[OS_CONFIG_LIB_PARAMETER_MAX_BLOB_BLOCK_SIZE];
-    size_t blobBlockSize = OS_ConfigServiceBackend_getSizeOfRecords(backend);
+    size_t recordSize = OS_ConfigServiceBackend_getSizeOfRecords(backend);
+    uint32_t record = index + offset / recordSize;
+    size_t recordOffset = offset % recordSize;
     size_t bytesCopied = 0;
 
-    while (bytesCopied < blobSize)
+    if (0 != recordOffset)
     {
-        OS_Error_t fetchResult = OS_ConfigServiceBackend_readRecord(
-                                     backend,
-                                     index,
-                                     tmpBuf,
-                                     sizeof(tmpBuf));
+        bytesCopied = recordSize - recordOffset;
+        if (bytesCopied > length)
+        {
+            bytesCopied = length;
+        }
 
-        if (OS_SUCCESS != fetchResult)
+        if (OS_SUCCESS != OS_ConfigServiceLib_patchRecord(
+                backend,
+                record,
+                recordOffset,
+                buffer,
+                bytesCopied))
         {
             Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
             return OS_ERROR_GENERIC;
         }
 
-        size_t bytesToCopy;
+        record++;
+    }
 
-        if ((blobSize - bytesCopied) >= blobBlockSize)
-        {
-            bytesToCopy = blobBlockSize;
-        }
-        else
-        {
-            bytesToCopy = blobSize - bytesCopied;
-        }
+    uint32_t fullRecords = (length - bytesCopied) / recordSize;
 
-        memcpy((char*)buffer + bytesCopied, tmpBuf, bytesToCopy);
+    if (OS_SUCCESS != OS_ConfigServiceBackend_writeRecords(
+            backend,
+            record,
+            fullRecords,
+            (char const*)buffer + bytesCopied,
+            fullRecords * recordSize))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_GENERIC;
+    }
 
-        bytesCopied += bytesToCopy;
-        index++;
+    bytesCopied += fullRecords * recordSize;
+    record += fullRecords;
+
+    if ((bytesCopied < length) &&
+        (OS_SUCCESS != OS_ConfigServiceLib_patchRecord(
+             backend,
+             record,
+             0,
+             (char const*)buffer + bytesCopied,
+             length - bytesCopied)))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_GENERIC;
     }
 
     return OS_SUCCESS;
@@ -286,47 +573,45 @@ OS_ConfigServiceLib_fetchVariableLengthBlob(
 //------------------------------------------------------------------------------
 static
 OS_Error_t
-OS_ConfigServiceLib_writeVariableLengthString(
+OS_ConfigServiceLib_fetchVariableLengthBlob(
     OS_ConfigServiceBackend_t* backend,
+    size_t blobSize,
     uint32_t index,
-    void const* buffer,
+    uint32_t numberOfBlocks,
+    void* buffer,
     size_t bufferSize)
 {
-    // We anticipate a maximum size here which should be ok to place on the stack.
-    char tmpBuf[OS_CONFIG_LIB_PARAMETER_MAX_STRING_SIZE];
-
-    if (bufferSize > OS_CONFIG_LIB_PARAMETER_MAX_STRING_SIZE)
+    if (blobSize > bufferSize)
     {
         Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
         return OS_ERROR_GENERIC;
     }
 
-    memset(tmpBuf, 0, OS_CONFIG_LIB_PARAMETER_MAX_STRING_SIZE);
-    memcpy(tmpBuf, buffer, bufferSize);
-
-    OS_Error_t writeResult = OS_ConfigServiceBackend_writeRecord(
-                                 backend,
-                                 index,
-                                 tmpBuf,
-                                 sizeof(tmpBuf));
-
-    return writeResult;
+    return OS_ConfigServiceLib_readRecordRange(
+               backend,
+               index,
+               numberOfBlocks,
+               0,
+               buffer,
+               blobSize);
 }
 
 //------------------------------------------------------------------------------
+// Writes a value into the given records, the part of the last record behind
+// the value is cleared.
 static
 OS_Error_t
-OS_ConfigServiceLib_writeVariableLengthBlob(
+OS_ConfigServiceLib_writeVariableLength(
     OS_ConfigServiceBackend_t* backend,
     uint32_t index,
-    uint32_t numberOfBlocks,
+    uint32_t numberOfRecords,
     void const* buffer,
     size_t bufferSize)
 {
-    size_t blobBlockSize = OS_ConfigServiceBackend_getSizeOfRecords(backend);
-    size_t blobCapacity = blobBlockSize * numberOfBlocks;
+    size_t recordSize = OS_ConfigServiceBackend_getSizeOfRecords(backend);
+    size_t capacity = recordSize * numberOfRecords;
 
-    if (bufferSize > blobCapacity)
+    if (bufferSize > capacity)
     {
         Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
         return OS_ERROR_GENERIC;
@@ -334,171 +619,2604 @@ OS_ConfigServiceLib_writeVariableLengthBlob(
 
     // We anticipate a maximum size here which should be ok to place on the stack.
     char tmpBuf[OS_CONFIG_LIB_PARAMETER_MAX_BLOB_BLOCK_SIZE];
-    size_t bytesCopied = 0;
+    uint32_t fullRecords = bufferSize / recordSize;
+    size_t bytesCopied = fullRecords * recordSize;
 
-    while (bytesCopied < bufferSize)
+    OS_Error_t writeResult = OS_ConfigServiceBackend_writeRecords(
+                                 backend,
+                                 index,
+                                 fullRecords,
+                                 buffer,
+                                 bytesCopied);
+    if (OS_SUCCESS != writeResult)
     {
-        size_t bytesToCopy;
-
-        if ((bufferSize - bytesCopied) >= blobBlockSize)
-        {
-            bytesToCopy = blobBlockSize;
-        }
-        else
-        {
-            bytesToCopy = bufferSize - bytesCopied;
-        }
-
-        memcpy(tmpBuf, (char*)buffer + bytesCopied, bytesToCopy);
-
-        OS_Error_t fetchResult = OS_ConfigServiceBackend_writeRecord(
-                                     backend,
-                                     index,
-                                     tmpBuf,
-                                     sizeof(tmpBuf));
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_GENERIC;
+    }
 
-        if (OS_SUCCESS != fetchResult)
+    if (bytesCopied < bufferSize)
+    {
+        memset(tmpBuf, 0, sizeof(tmpBuf));
+        memcpy(tmpBuf, (char const*)buffer + bytesCopied, bufferSize - bytesCopied);
+
+        writeResult = OS_ConfigServiceBackend_writeRecord(
+                          backend,
+                          index + fullRecords,
+                          tmpBuf,
+                          recordSize);
+        if (OS_SUCCESS != writeResult)
         {
             Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
             return OS_ERROR_GENERIC;
         }
-
-        bytesCopied += bytesToCopy;
-        index++;
     }
 
     return OS_SUCCESS;
 }
 
 //------------------------------------------------------------------------------
-OS_Error_t
-OS_ConfigServiceLib_Init(
-    OS_ConfigServiceLib_t* instance,
-    OS_ConfigServiceBackend_t const* parameterBackend,
-    OS_ConfigServiceBackend_t const* domainBackend,
-    OS_ConfigServiceBackend_t const* stringBackend,
-    OS_ConfigServiceBackend_t const* blobBackend)
+// Number of records a string or blob of the given size occupies. Even an empty
+// value keeps a record, so existing configurations with one record per string
+// stay valid. The size must be one that was stored or checked already, sizes
+// passed by callers go through OS_ConfigServiceLib_getNumberOfBlobBlocks().
+static
+uint32_t
+OS_ConfigServiceLib_getNumberOfRecords(
+    OS_ConfigServiceBackend_t const* backend,
+    size_t valueSize)
 {
-    instance->isInitialized = false;
-
-    if (OS_ConfigServiceBackend_getSizeOfRecords(parameterBackend) != sizeof(
-            OS_ConfigServiceLibTypes_Parameter_t))
-    {
-        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
-        return OS_ERROR_INVALID_PARAMETER;
-    }
+    size_t recordSize = OS_ConfigServiceBackend_getSizeOfRecords(backend);
 
-    if (OS_ConfigServiceBackend_getSizeOfRecords(domainBackend) != sizeof(
-            OS_ConfigServiceLibTypes_Domain_t))
+    if (0 == valueSize)
     {
-        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
-        return OS_ERROR_INVALID_PARAMETER;
+        return 1;
     }
 
-    if (OS_ConfigServiceBackend_getSizeOfRecords(stringBackend) !=
-        OS_CONFIG_LIB_PARAMETER_MAX_STRING_SIZE)
-    {
-        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
-        return OS_ERROR_INVALID_PARAMETER;
-    }
+    return (uint32_t)(valueSize / recordSize + ((0 != valueSize % recordSize) ? 1 : 0));
+}
 
-    if (OS_ConfigServiceBackend_getSizeOfRecords(blobBackend) !=
-        OS_CONFIG_LIB_PARAMETER_MAX_BLOB_BLOCK_SIZE)
+//------------------------------------------------------------------------------
+// Number of blocks a blob of the given size occupies. Returns
+// OS_ERROR_INVALID_PARAMETER if the size does not fit into the 32 bits it is
+// stored in or the blob would need more blocks than the blob backend has.
+static
+OS_Error_t
+OS_ConfigServiceLib_getNumberOfBlobBlocks(
+    OS_ConfigServiceLib_t const* instance,
+    size_t blobSize,
+    uint32_t* numberOfBlocks)
+{
+    if ((blobSize > UINT32_MAX) ||
+        !OS_ConfigServiceLib_isRangeInRecords(
+            &instance->blobBackend,
+            OS_ConfigServiceBackend_getNumberOfRecords(&instance->blobBackend),
+            0,
+            blobSize))
     {
         Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
         return OS_ERROR_INVALID_PARAMETER;
     }
 
-    instance->parameterBackend = *parameterBackend;
-    instance->domainBackend = *domainBackend;
-    instance->stringBackend = *stringBackend;
-    instance->blobBackend = *blobBackend;
-
-    instance->isInitialized = true;
+    *numberOfBlocks = OS_ConfigServiceLib_getNumberOfRecords(
+                          &instance->blobBackend,
+                          blobSize);
 
     return OS_SUCCESS;
 }
 
 //------------------------------------------------------------------------------
+static
 OS_Error_t
-OS_ConfigServiceLib_domainEnumeratorInit(
-    OS_ConfigServiceLib_t const* instance,
-    OS_ConfigServiceLibTypes_DomainEnumerator_t* enumerator)
-{
-    if (!instance->isInitialized)
-    {
-        LOG_NOT_INITIALIZED(__func__);
+OS_ConfigServiceLib_fetchVariableLengthString(
+    OS_ConfigServiceBackend_t* backend,
+    uint32_t index,
+    size_t stringSize,
+    void* buffer,
+    size_t bufferSize)
+{
+    if (stringSize > bufferSize)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_GENERIC;
+    }
+
+    uint32_t numberOfRecords = OS_ConfigServiceLib_getNumberOfRecords(
+                                   backend,
+                                   stringSize);
+
+    // A buffer that can take all records of the string is filled directly.
+    if (bufferSize >= numberOfRecords * OS_ConfigServiceBackend_getSizeOfRecords(
+            backend))
+    {
+        OS_Error_t fetchResult = OS_ConfigServiceBackend_readRecords(
+                                     backend,
+                                     index,
+                                     numberOfRecords,
+                                     buffer,
+                                     bufferSize);
+        if (OS_SUCCESS != fetchResult)
+        {
+            Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        }
+
+        return fetchResult;
+    }
+
+    return OS_ConfigServiceLib_readRecordRange(
+               backend,
+               index,
+               numberOfRecords,
+               0,
+               buffer,
+               stringSize);
+}
+
+//------------------------------------------------------------------------------
+// Returns the extent holding the string or blob of the given parameter. Returns
+// false for other types.
+static
+bool
+OS_ConfigServiceLib_getValueExtent(
+    OS_ConfigServiceLib_t* instance,
+    OS_ConfigServiceLibTypes_Parameter_t const* parameter,
+    OS_ConfigServiceExtentMap_t** map,
+    uint32_t* index,
+    uint32_t* numberOfRecords)
+{
+    switch (parameter->parameterType)
+    {
+    case OS_CONFIG_LIB_PARAMETER_TYPE_STRING:
+        *map = &instance->stringExtents;
+        *index = parameter->parameterValue.valueString.index;
+        *numberOfRecords = OS_ConfigServiceLib_getNumberOfRecords(
+                               &instance->stringBackend,
+                               parameter->parameterValue.valueString.size);
+        return true;
+
+    case OS_CONFIG_LIB_PARAMETER_TYPE_BLOB:
+        *map = &instance->blobExtents;
+        *index = parameter->parameterValue.valueBlob.index;
+        *numberOfRecords = parameter->parameterValue.valueBlob.numberOfBlocks;
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Releases the records of the old extent the new one does not use. With the
+// extents swapped, it releases the records a write allocated for a value that
+// could not be stored.
+static
+void
+OS_ConfigServiceLib_releaseReplacedExtent(
+    OS_ConfigServiceExtentMap_t* map,
+    uint32_t index,
+    uint32_t numberOfRecords,
+    uint32_t oldIndex,
+    uint32_t oldRecords)
+{
+    if (index != oldIndex)
+    {
+        OS_ConfigServiceExtentMap_release(map, oldIndex, oldRecords);
+    }
+    else if (oldRecords > numberOfRecords)
+    {
+        OS_ConfigServiceExtentMap_release(
+            map,
+            index + numberOfRecords,
+            oldRecords - numberOfRecords);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Releases the records of the value of the old parameter the value of the new
+// one does not use.
+static
+void
+OS_ConfigServiceLib_releaseReplacedValue(
+    OS_ConfigServiceLib_t* instance,
+    OS_ConfigServiceLibTypes_Parameter_t const* parameter,
+    OS_ConfigServiceLibTypes_Parameter_t const* oldParameter)
+{
+    OS_ConfigServiceExtentMap_t* map;
+    uint32_t index;
+    uint32_t numberOfRecords;
+    uint32_t oldIndex;
+    uint32_t oldRecords;
+
+    if (OS_ConfigServiceLib_getValueExtent(
+            instance,
+            parameter,
+            &map,
+            &index,
+            &numberOfRecords) &&
+        OS_ConfigServiceLib_getValueExtent(
+            instance,
+            oldParameter,
+            &map,
+            &oldIndex,
+            &oldRecords))
+    {
+        OS_ConfigServiceLib_releaseReplacedExtent(
+            map,
+            index,
+            numberOfRecords,
+            oldIndex,
+            oldRecords);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Writes a string to the records of the given parameter and updates its value.
+// A string that needs more records than it has or that shares its records with
+// other values is moved to a free extent of the string backend. The parameter
+// record itself is not written, so the records the string no longer needs are
+// left to the caller to release once it is.
+static
+OS_Error_t
+OS_ConfigServiceLib_writeVariableLengthString(
+    OS_ConfigServiceLib_t* instance,
+    OS_ConfigServiceLibTypes_Parameter_t* parameter,
+    void const* buffer,
+    size_t bufferSize)
+{
+    OS_ConfigServiceBackend_t* backend = &instance->stringBackend;
+    uint32_t oldIndex = parameter->parameterValue.valueString.index;
+    uint32_t oldRecords = OS_ConfigServiceLib_getNumberOfRecords(
+                              backend,
+                              parameter->parameterValue.valueString.size);
+    uint32_t newRecords = OS_ConfigServiceLib_getNumberOfRecords(
+                              backend,
+                              bufferSize);
+    uint32_t index = oldIndex;
+
+    // Records shared with other values are never written in place.
+    if ((newRecords > oldRecords) ||
+        OS_ConfigServiceExtentMap_isShared(
+            &instance->stringExtents,
+            oldIndex,
+            oldRecords))
+    {
+        OS_Error_t err = OS_ConfigServiceExtentMap_allocate(
+                             &instance->stringExtents,
+                             newRecords,
+                             &index);
+        if (OS_SUCCESS != err)
+        {
+            Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+            return err;
+        }
+    }
+
+    OS_Error_t writeResult = OS_ConfigServiceLib_writeVariableLength(
+                                 backend,
+                                 index,
+                                 newRecords,
+                                 buffer,
+                                 bufferSize);
+    if (OS_SUCCESS != writeResult)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        OS_ConfigServiceLib_releaseReplacedExtent(
+            &instance->stringExtents,
+            oldIndex,
+            oldRecords,
+            index,
+            newRecords);
+        return writeResult;
+    }
+
+    parameter->parameterValue.valueString.index = index;
+    parameter->parameterValue.valueString.size = bufferSize;
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Returns true if the blob of the given parameter has to move to take the
+// given number of blocks, because they are more than it has or its blocks are
+// shared with other values.
+static
+bool
+OS_ConfigServiceLib_isBlobMoving(
+    OS_ConfigServiceLib_t const* instance,
+    OS_ConfigServiceLibTypes_Parameter_t const* parameter,
+    uint32_t numberOfBlocks)
+{
+    uint32_t oldBlocks = parameter->parameterValue.valueBlob.numberOfBlocks;
+
+    return ((numberOfBlocks > oldBlocks) ||
+            OS_ConfigServiceExtentMap_isShared(
+                &instance->blobExtents,
+                parameter->parameterValue.valueBlob.index,
+                oldBlocks));
+}
+
+//------------------------------------------------------------------------------
+// Copies records within a backend, the ranges must not overlap.
+static
+OS_Error_t
+OS_ConfigServiceLib_copyRecords(
+    OS_ConfigServiceBackend_t* backend,
+    uint32_t fromIndex,
+    uint32_t toIndex,
+    uint32_t numberOfRecords)
+{
+    // We anticipate a maximum size here which should be ok to place on the stack.
+    char tmpBuf[OS_CONFIG_LIB_PARAMETER_MAX_BLOB_BLOCK_SIZE];
+    size_t recordSize = OS_ConfigServiceBackend_getSizeOfRecords(backend);
+
+    for (uint32_t k = 0; k < numberOfRecords; ++k)
+    {
+        OS_Error_t err = OS_ConfigServiceBackend_readRecord(
+                             backend,
+                             fromIndex + k,
+                             tmpBuf,
+                             sizeof(tmpBuf));
+        if (OS_SUCCESS == err)
+        {
+            err = OS_ConfigServiceBackend_writeRecord(
+                      backend,
+                      toIndex + k,
+                      tmpBuf,
+                      recordSize);
+        }
+
+        if (OS_SUCCESS != err)
+        {
+            Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+            return err;
+        }
+    }
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Gives the blob of the given parameter the given number of blocks. A blob that
+// needs more blocks than it has or that shares its blocks with other values is
+// moved to a free extent of the blob backend, taking along the given number of
+// its first blocks. The parameter record itself is not written, so the blocks
+// the blob no longer needs are left to the caller to release once it is.
+static
+OS_Error_t
+OS_ConfigServiceLib_resizeBlobExtent(
+    OS_ConfigServiceLib_t* instance,
+    OS_ConfigServiceLibTypes_Parameter_t* parameter,
+    uint32_t numberOfBlocks,
+    uint32_t blocksToKeep)
+{
+    uint32_t oldIndex = parameter->parameterValue.valueBlob.index;
+    uint32_t oldBlocks = parameter->parameterValue.valueBlob.numberOfBlocks;
+
+    if ((numberOfBlocks <= oldBlocks) &&
+        !OS_ConfigServiceExtentMap_isShared(
+            &instance->blobExtents,
+            oldIndex,
+            oldBlocks))
+    {
+        parameter->parameterValue.valueBlob.numberOfBlocks = numberOfBlocks;
+        return OS_SUCCESS;
+    }
+
+    uint32_t index;
+    OS_Error_t err = OS_ConfigServiceExtentMap_allocate(
+                         &instance->blobExtents,
+                         numberOfBlocks,
+                         &index);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return err;
+    }
+
+    err = OS_ConfigServiceLib_copyRecords(
+              &instance->blobBackend,
+              oldIndex,
+              index,
+              (blocksToKeep < oldBlocks) ? blocksToKeep : oldBlocks);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        OS_ConfigServiceExtentMap_release(
+            &instance->blobExtents,
+            index,
+            numberOfBlocks);
+        return err;
+    }
+
+    parameter->parameterValue.valueBlob.index = index;
+    parameter->parameterValue.valueBlob.numberOfBlocks = numberOfBlocks;
+
+    return OS_SUCCESS;
+}
+
+#if defined(OS_CONFIG_SERVICE_DEDUP)
+
+//------------------------------------------------------------------------------
+// Hashes the string or blob value stored in the given records.
+static
+OS_Error_t
+OS_ConfigServiceLib_hashStoredValue(
+    OS_ConfigServiceBackend_t* backend,
+    uint32_t index,
+    size_t size,
+    uint32_t* hash)
+{
+    // We anticipate a maximum size here which should be ok to place on the stack.
+    char tmpBuf[OS_CONFIG_LIB_PARAMETER_MAX_BLOB_BLOCK_SIZE];
+    size_t recordSize = OS_ConfigServiceBackend_getSizeOfRecords(backend);
+
+    *hash = OS_CONFIG_SERVICE_DEDUP_HASH_INIT;
+
+    for (size_t offset = 0; offset < size; offset += recordSize)
+    {
+        OS_Error_t err = OS_ConfigServiceBackend_readRecord(
+                             backend,
+                             index + offset / recordSize,
+                             tmpBuf,
+                             sizeof(tmpBuf));
+        if (OS_SUCCESS != err)
+        {
+            Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+            return err;
+        }
+
+        *hash = OS_ConfigServiceDedup_hash(
+                    *hash,
+                    tmpBuf,
+                    (size - offset < recordSize) ? size - offset : recordSize);
+    }
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Returns true if the given records hold the given value.
+static
+bool
+OS_ConfigServiceLib_isValueStored(
+    OS_ConfigServiceBackend_t* backend,
+    uint32_t index,
+    void const* buffer,
+    size_t size)
+{
+    // We anticipate a maximum size here which should be ok to place on the stack.
+    char tmpBuf[OS_CONFIG_LIB_PARAMETER_MAX_BLOB_BLOCK_SIZE];
+    size_t recordSize = OS_ConfigServiceBackend_getSizeOfRecords(backend);
+
+    for (size_t offset = 0; offset < size; offset += recordSize)
+    {
+        size_t chunkSize = (size - offset < recordSize) ? size - offset : recordSize;
+
+        if ((OS_SUCCESS != OS_ConfigServiceBackend_readRecord(
+                 backend,
+                 index + offset / recordSize,
+                 tmpBuf,
+                 sizeof(tmpBuf))) ||
+            (0 != memcmp(tmpBuf, (char const*)buffer + offset, chunkSize)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Lets the string or blob of the given parameter refer to a stored copy of the
+// given value, if there is one. The copy is acquired for the parameter, the
+// records of its old value are left to the caller to release once the
+// parameter record is written. Returns false if the value has to be written.
+static
+bool
+OS_ConfigServiceLib_shareValue(
+    OS_ConfigServiceLib_t* instance,
+    OS_ConfigServiceLibTypes_Parameter_t* parameter,
+    void const* buffer,
+    size_t bufferSize,
+    uint32_t hash)
+{
+    OS_ConfigServiceBackend_t* backend;
+    OS_ConfigServiceExtentMap_t* map;
+    OS_ConfigServiceDedup_t* table;
+
+    switch (parameter->parameterType)
+    {
+    case OS_CONFIG_LIB_PARAMETER_TYPE_STRING:
+        backend = &instance->stringBackend;
+        map = &instance->stringExtents;
+        table = &instance->stringValues;
+        break;
+
+    case OS_CONFIG_LIB_PARAMETER_TYPE_BLOB:
+        backend = &instance->blobBackend;
+        map = &instance->blobExtents;
+        table = &instance->blobValues;
+        break;
+
+    default:
+        return false;
+    }
+
+    OS_ConfigServiceDedup_Entry_t entry;
+
+    // The table may still know records that were freed or rewritten since.
+    if (!OS_ConfigServiceDedup_lookup(table, hash, bufferSize, &entry) ||
+        (0 == OS_ConfigServiceExtentMap_getReferences(map, entry.index)) ||
+        !OS_ConfigServiceLib_isValueStored(backend, entry.index, buffer, bufferSize))
+    {
+        return false;
+    }
+
+    OS_ConfigServiceExtentMap_acquire(map, entry.index, entry.numberOfRecords);
+
+    if (OS_CONFIG_LIB_PARAMETER_TYPE_STRING == parameter->parameterType)
+    {
+        parameter->parameterValue.valueString.index = entry.index;
+        parameter->parameterValue.valueString.size = bufferSize;
+    }
+    else
+    {
+        parameter->parameterValue.valueBlob.index = entry.index;
+        parameter->parameterValue.valueBlob.numberOfBlocks = entry.numberOfRecords;
+        parameter->parameterValue.valueBlob.size = bufferSize;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Releases the records of the string or blob of the given parameter.
+static
+void
+OS_ConfigServiceLib_releaseValue(
+    OS_ConfigServiceLib_t* instance,
+    OS_ConfigServiceLibTypes_Parameter_t const* parameter)
+{
+    OS_ConfigServiceExtentMap_t* map;
+    uint32_t index;
+    uint32_t numberOfRecords;
+
+    if (OS_ConfigServiceLib_getValueExtent(
+            instance,
+            parameter,
+            &map,
+            &index,
+            &numberOfRecords))
+    {
+        OS_ConfigServiceExtentMap_release(map, index, numberOfRecords);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Adds the string or blob value of the given parameter to the known values.
+static
+void
+OS_ConfigServiceLib_rememberValue(
+    OS_ConfigServiceLib_t* instance,
+    OS_ConfigServiceLibTypes_Parameter_t const* parameter,
+    uint32_t hash)
+{
+    switch (parameter->parameterType)
+    {
+    case OS_CONFIG_LIB_PARAMETER_TYPE_STRING:
+        OS_ConfigServiceDedup_insert(
+            &instance->stringValues,
+            hash,
+            parameter->parameterValue.valueString.size,
+            parameter->parameterValue.valueString.index,
+            OS_ConfigServiceLib_getNumberOfRecords(
+                &instance->stringBackend,
+                parameter->parameterValue.valueString.size));
+        break;
+
+    case OS_CONFIG_LIB_PARAMETER_TYPE_BLOB:
+        OS_ConfigServiceDedup_insert(
+            &instance->blobValues,
+            hash,
+            parameter->parameterValue.valueBlob.size,
+            parameter->parameterValue.valueBlob.index,
+            parameter->parameterValue.valueBlob.numberOfBlocks);
+        break;
+
+    default:
+        break;
+    }
+}
+
+#endif // OS_CONFIG_SERVICE_DEDUP
+
+//------------------------------------------------------------------------------
+// Commits the records written to the given backend to the storage. Backends
+// with a write-back cache keep them in RAM until they are flushed explicitly.
+static
+OS_Error_t
+OS_ConfigServiceLib_commitBackend(
+    OS_ConfigServiceBackend_t* backend)
+{
+    OS_ConfigServiceBackendCache_t* cache = OS_ConfigServiceBackend_getCache(
+                                                backend);
+
+    if ((NULL != cache) &&
+        (OS_CONFIG_BACKEND_CACHE_POLICY_WRITE_BACK ==
+         OS_ConfigServiceBackendCache_getPolicy(cache)))
+    {
+        return OS_SUCCESS;
+    }
+
+    OS_Error_t err = OS_ConfigServiceBackend_flush(backend);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_ERROR("OS_ConfigServiceBackend_flush() failed, error %d", err);
+    }
+
+    return err;
+}
+
+//------------------------------------------------------------------------------
+// Commits the records of the given parameter to the storage, the payload
+// first and the parameter record last.
+static
+OS_Error_t
+OS_ConfigServiceLib_flushParameter(
+    OS_ConfigServiceLib_t* instance,
+    OS_ConfigServiceLibTypes_Parameter_t const* parameter)
+{
+    OS_Error_t err = OS_SUCCESS;
+
+    switch (parameter->parameterType)
+    {
+    case OS_CONFIG_LIB_PARAMETER_TYPE_STRING:
+        err = OS_ConfigServiceLib_commitBackend(&instance->stringBackend);
+        break;
+
+    case OS_CONFIG_LIB_PARAMETER_TYPE_BLOB:
+        err = OS_ConfigServiceLib_commitBackend(&instance->blobBackend);
+        break;
+
+    default:
+        break;
+    }
+
+    if (OS_SUCCESS != err)
+    {
+        return err;
+    }
+
+    return OS_ConfigServiceLib_commitBackend(&instance->parameterBackend);
+}
+
+//------------------------------------------------------------------------------
+// Reads all domain and parameter records once, fills the name index and marks
+// the records used by strings and blobs in the extent maps. If the
+// configuration exceeds the capacity of the index, it is left unused and the
+// lookups scan the backends.
+static
+OS_Error_t
+OS_ConfigServiceLib_buildIndex(
+    OS_ConfigServiceLib_t* instance)
+{
+    OS_ConfigServiceIndex_t* index = &instance->index;
+    bool isIndexUsable = true;
+    OS_Error_t err;
+
+    OS_ConfigServiceIndex_init(index);
+    OS_ConfigServiceExtentMap_init(
+        &instance->stringExtents,
+        OS_ConfigServiceBackend_getNumberOfRecords(&instance->stringBackend));
+    OS_ConfigServiceExtentMap_init(
+        &instance->blobExtents,
+        OS_ConfigServiceBackend_getNumberOfRecords(&instance->blobBackend));
+
+    if (!OS_ConfigServiceExtentMap_isValid(&instance->stringExtents))
+    {
+        Debug_LOG_ERROR(
+            "extent map holds %u of %u string records, raise OS_CONFIG_SERVICE_EXTENT_MAP_MAX_RECORDS, strings cannot grow",
+            (unsigned int)OS_CONFIG_SERVICE_EXTENT_MAP_MAX_RECORDS,
+            OS_ConfigServiceBackend_getNumberOfRecords(&instance->stringBackend));
+    }
+
+    if (!OS_ConfigServiceExtentMap_isValid(&instance->blobExtents))
+    {
+        Debug_LOG_ERROR(
+            "extent map holds %u of %u blob blocks, raise OS_CONFIG_SERVICE_EXTENT_MAP_MAX_RECORDS, blobs cannot grow",
+            (unsigned int)OS_CONFIG_SERVICE_EXTENT_MAP_MAX_RECORDS,
+            OS_ConfigServiceBackend_getNumberOfRecords(&instance->blobBackend));
+    }
+
+#if defined(OS_CONFIG_SERVICE_DEDUP)
+    OS_ConfigServiceDedup_init(&instance->stringValues);
+    OS_ConfigServiceDedup_init(&instance->blobValues);
+#endif
+
+    unsigned int numberOfDomains = OS_ConfigServiceBackend_getNumberOfRecords(
+                                       &instance->domainBackend);
+    for (unsigned int k = 0; k < numberOfDomains; ++k)
+    {
+        OS_ConfigServiceLibTypes_Domain_t domain;
+        err = OS_ConfigServiceBackend_readRecord(
+                  &instance->domainBackend,
+                  k,
+                  &domain,
+                  sizeof(domain));
+        if (OS_SUCCESS != err)
+        {
+            Debug_LOG_ERROR("OS_ConfigServiceBackend_readRecord() failed, error %d", err);
+            return err;
+        }
+
+        err = OS_ConfigServiceIndex_addDomain(index, &domain.name, k);
+        if (OS_SUCCESS != err)
+        {
+            Debug_LOG_ERROR(
+                "index holds %u of %u domains, raise OS_CONFIG_SERVICE_INDEX_MAX_DOMAINS, all lookups scan the backends",
+                (unsigned int)OS_CONFIG_SERVICE_INDEX_MAX_DOMAINS,
+                numberOfDomains);
+            isIndexUsable = false;
+            break;
+        }
+    }
+
+    unsigned int numberOfParameters = OS_ConfigServiceBackend_getNumberOfRecords(
+                                          &instance->parameterBackend);
+    for (unsigned int k = 0; k < numberOfParameters; ++k)
+    {
+        OS_ConfigServiceLibTypes_Parameter_t parameter;
+        err = OS_ConfigServiceLib_readParameter(
+                  instance,
+                  k,
+                  &parameter);
+        if (OS_SUCCESS != err)
+        {
+            Debug_LOG_ERROR("OS_ConfigServiceLib_readParameter() failed, error %d", err);
+            return err;
+        }
+
+        if (OS_CONFIG_LIB_PARAMETER_TYPE_STRING == parameter.parameterType)
+        {
+            OS_ConfigServiceExtentMap_acquire(
+                &instance->stringExtents,
+                parameter.parameterValue.valueString.index,
+                OS_ConfigServiceLib_getNumberOfRecords(
+                    &instance->stringBackend,
+                    parameter.parameterValue.valueString.size));
+        }
+        else if (OS_CONFIG_LIB_PARAMETER_TYPE_BLOB == parameter.parameterType)
+        {
+            OS_ConfigServiceExtentMap_acquire(
+                &instance->blobExtents,
+                parameter.parameterValue.valueBlob.index,
+                parameter.parameterValue.valueBlob.numberOfBlocks);
+        }
+
+#if defined(OS_CONFIG_SERVICE_DEDUP)
+        uint32_t hash;
+
+        if ((OS_CONFIG_LIB_PARAMETER_TYPE_STRING == parameter.parameterType) &&
+            (OS_SUCCESS == OS_ConfigServiceLib_hashStoredValue(
+                 &instance->stringBackend,
+                 parameter.parameterValue.valueString.index,
+                 parameter.parameterValue.valueString.size,
+                 &hash)))
+        {
+            OS_ConfigServiceLib_rememberValue(instance, &parameter, hash);
+        }
+        else if ((OS_CONFIG_LIB_PARAMETER_TYPE_BLOB == parameter.parameterType) &&
+                 (OS_SUCCESS == OS_ConfigServiceLib_hashStoredValue(
+                      &instance->blobBackend,
+                      parameter.parameterValue.valueBlob.index,
+                      parameter.parameterValue.valueBlob.size,
+                      &hash)))
+        {
+            OS_ConfigServiceLib_rememberValue(instance, &parameter, hash);
+        }
+#endif
+
+        if (!isIndexUsable)
+        {
+            continue;
+        }
+
+        OS_ConfigServiceLibTypes_ParameterName_t parameterName =
+            parameter.parameterName;
+        err = OS_ConfigServiceIndex_addParameter(
+                  index,
+                  parameter.domain.index,
+                  &parameterName,
+                  k);
+        if (OS_SUCCESS != err)
+        {
+            Debug_LOG_ERROR(
+                "index holds %u of %u parameters, raise OS_CONFIG_SERVICE_INDEX_MAX_PARAMETERS, all lookups scan the backends",
+                (unsigned int)OS_CONFIG_SERVICE_INDEX_MAX_PARAMETERS,
+                numberOfParameters);
+            isIndexUsable = false;
+            continue;
+        }
+
+        OS_ConfigServiceIndex_setParameterAccess(
+            index,
+            k,
+            &parameter.readAccess);
+    }
+
+    if (isIndexUsable)
+    {
+        OS_ConfigServiceIndex_complete(index);
+    }
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Reads the given parameter record and tells if it has the given domain and
+// name. Version 2 records of other names are mostly rejected by their name
+// hash, without decoding them.
+static
+OS_Error_t
+OS_ConfigServiceLib_readNamedParameter(
+    OS_ConfigServiceLib_t* instance,
+    uint32_t parameterIndex,
+    uint32_t domainIndex,
+    OS_ConfigServiceLibTypes_ParameterName_t const* parameterName,
+    uint32_t nameHash,
+    OS_ConfigServiceLibTypes_Parameter_t* parameter,
+    bool* isNamed)
+{
+    OS_Error_t err;
+
+    *isNamed = false;
+
+    if (OS_ConfigServiceLib_hasCompactParameters(instance))
+    {
+        OS_ConfigServiceParameterRecord_t record;
+
+        err = OS_ConfigServiceBackend_readRecord(
+                  &instance->parameterBackend,
+                  parameterIndex,
+                  &record,
+                  sizeof(record));
+        if (OS_SUCCESS != err)
+        {
+            return err;
+        }
+
+        if ((record.domainIndex != domainIndex) || (record.nameHash != nameHash))
+        {
+            return OS_SUCCESS;
+        }
+
+        err = OS_ConfigServiceParameterRecord_decode(parameter, &record);
+    }
+    else
+    {
+        err = OS_ConfigServiceLib_readParameter(
+                  instance,
+                  parameterIndex,
+                  parameter);
+    }
+
+    if (OS_SUCCESS != err)
+    {
+        return err;
+    }
+
+    *isNamed = (parameter->domain.index == domainIndex) &&
+               (OS_SUCCESS == OS_ConfigServiceLib_compareParameterName(
+                    &parameter->parameterName,
+                    parameterName));
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Looks up the parameter with the given name in the given domain through the
+// index, which must be valid. Only parameters visible for the given app are
+// found.
+static
+OS_Error_t
+OS_ConfigServiceLib_lookupParameter(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_DomainEnumerator_t const* domainEnumerator,
+    OS_ConfigServiceLibTypes_ParameterName_t const* parameterName,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t* parameterEnumerator,
+    OS_ConfigServiceLibTypes_Parameter_t* parameter)
+{
+    OS_ConfigServiceIndex_Cursor_t cursor;
+    uint32_t parameterIndex;
+    uint32_t nameHash = OS_ConfigServiceParameterRecord_hashName(parameterName);
+
+    OS_ConfigServiceIndex_beginParameterLookup(
+        &instance->index,
+        domainEnumerator->index,
+        parameterName,
+        &cursor);
+
+    while (OS_ConfigServiceIndex_nextParameter(
+               &instance->index,
+               &cursor,
+               &parameterIndex))
+    {
+        bool isNamed;
+
+        // Candidates the app can't see are skipped without reading them.
+        if (!OS_ConfigServiceIndex_isParameterVisible(
+                &instance->index,
+                parameterIndex,
+                appId))
+        {
+            continue;
+        }
+
+        OS_Error_t err = OS_ConfigServiceLib_readNamedParameter(
+                             instance,
+                             parameterIndex,
+                             domainEnumerator->index,
+                             parameterName,
+                             nameHash,
+                             parameter,
+                             &isNamed);
+        if (OS_SUCCESS != err)
+        {
+            Debug_LOG_ERROR("OS_ConfigServiceLib_readNamedParameter() failed, error %d",
+                            err);
+            return OS_ERROR_GENERIC;
+        }
+
+        if (isNamed)
+        {
+            parameterEnumerator->index = parameterIndex;
+            parameterEnumerator->domainEnumerator = *domainEnumerator;
+            return OS_SUCCESS;
+        }
+    }
+
+    Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+    return OS_ERROR_GENERIC;
+}
+
+//------------------------------------------------------------------------------
+// Reads all records of the backends of the given instance into consecutive
+// parts of the given buffer.
+static
+OS_Error_t
+OS_ConfigServiceLib_preloadBackends(
+    OS_ConfigServiceLib_t* instance,
+    void* buffer,
+    size_t bufferSize)
+{
+    OS_ConfigServiceBackend_t* backends[] =
+    {
+        &instance->parameterBackend,
+        &instance->domainBackend,
+        &instance->stringBackend,
+        &instance->blobBackend,
+    };
+
+    size_t offset = 0;
+
+    for (unsigned int k = 0; k < sizeof(backends) / sizeof(backends[0]); ++k)
+    {
+        size_t size = OS_ConfigServiceBackend_getMirrorSize(backends[k]);
+
+        if (size > bufferSize - offset)
+        {
+            Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+            return OS_ERROR_BUFFER_TOO_SMALL;
+        }
+
+        OS_Error_t err = OS_ConfigServiceBackend_attachMirror(
+                             backends[k],
+                             (char*)buffer + offset,
+                             size);
+        if (OS_SUCCESS != err)
+        {
+            Debug_LOG_ERROR("OS_ConfigServiceBackend_attachMirror() failed, error %d",
+                            err);
+            return err;
+        }
+
+        offset += size;
+    }
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+static
+OS_Error_t
+OS_ConfigServiceLib_initInstance(
+    OS_ConfigServiceLib_t* instance,
+    OS_ConfigServiceBackend_t const* parameterBackend,
+    OS_ConfigServiceBackend_t const* domainBackend,
+    OS_ConfigServiceBackend_t const* stringBackend,
+    OS_ConfigServiceBackend_t const* blobBackend,
+    void* preloadBuffer,
+    size_t preloadBufferSize)
+{
+    instance->isInitialized = false;
+
+    // Version 1 or version 2 parameter records.
+    if ((OS_ConfigServiceBackend_getSizeOfRecords(parameterBackend) != sizeof(
+             OS_ConfigServiceParameterRecordV1_t)) &&
+        (OS_ConfigServiceBackend_getSizeOfRecords(parameterBackend) != sizeof(
+             OS_ConfigServiceParameterRecord_t)))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
+    if (OS_ConfigServiceBackend_getSizeOfRecords(domainBackend) != sizeof(
+            OS_ConfigServiceLibTypes_Domain_t))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
+    if ((0 == OS_ConfigServiceBackend_getSizeOfRecords(stringBackend)) ||
+        (OS_ConfigServiceBackend_getSizeOfRecords(stringBackend) >
+         OS_CONFIG_LIB_PARAMETER_MAX_STRING_SIZE))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
+    if (OS_ConfigServiceBackend_getSizeOfRecords(blobBackend) !=
+        OS_CONFIG_LIB_PARAMETER_MAX_BLOB_BLOCK_SIZE)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
+    instance->parameterBackend = *parameterBackend;
+    instance->domainBackend = *domainBackend;
+    instance->stringBackend = *stringBackend;
+    instance->blobBackend = *blobBackend;
+
+    instance->compactionCursor = 0;
+    instance->hasCompactionMoved = false;
+
+    OS_Error_t err;
+
+    // Preloading comes first, so building the index is served from RAM, too.
+    if (NULL != preloadBuffer)
+    {
+        err = OS_ConfigServiceLib_preloadBackends(
+                  instance,
+                  preloadBuffer,
+                  preloadBufferSize);
+        if (OS_SUCCESS != err)
+        {
+            return err;
+        }
+    }
+
+    err = OS_ConfigServiceLib_buildIndex(instance);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_ERROR("OS_ConfigServiceLib_buildIndex() failed, error %d", err);
+        return err;
+    }
+
+    instance->isInitialized = true;
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceLib_Init(
+    OS_ConfigServiceLib_t* instance,
+    OS_ConfigServiceBackend_t const* parameterBackend,
+    OS_ConfigServiceBackend_t const* domainBackend,
+    OS_ConfigServiceBackend_t const* stringBackend,
+    OS_ConfigServiceBackend_t const* blobBackend)
+{
+    return OS_ConfigServiceLib_initInstance(
+               instance,
+               parameterBackend,
+               domainBackend,
+               stringBackend,
+               blobBackend,
+               NULL,
+               0);
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceLib_InitPreloaded(
+    OS_ConfigServiceLib_t* instance,
+    OS_ConfigServiceBackend_t const* parameterBackend,
+    OS_ConfigServiceBackend_t const* domainBackend,
+    OS_ConfigServiceBackend_t const* stringBackend,
+    OS_ConfigServiceBackend_t const* blobBackend,
+    void* buffer,
+    size_t bufferSize)
+{
+    if (NULL == buffer)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
+    return OS_ConfigServiceLib_initInstance(
+               instance,
+               parameterBackend,
+               domainBackend,
+               stringBackend,
+               blobBackend,
+               buffer,
+               bufferSize);
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceLib_flush(
+    OS_ConfigServiceLib_t* instance)
+{
+    if (!instance->isInitialized)
+    {
+        LOG_NOT_INITIALIZED(__func__);
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    // Payload backends first, so a parameter record never refers to data that
+    // is not committed yet.
+    OS_ConfigServiceBackend_t* backends[] =
+    {
+        &instance->stringBackend,
+        &instance->blobBackend,
+        &instance->parameterBackend,
+        &instance->domainBackend,
+    };
+
+    for (unsigned int k = 0; k < sizeof(backends) / sizeof(backends[0]); ++k)
+    {
+        OS_Error_t err = OS_ConfigServiceBackend_flush(backends[k]);
+        if (OS_SUCCESS != err)
+        {
+            Debug_LOG_ERROR("OS_ConfigServiceBackend_flush() failed, error %d", err);
+            return err;
+        }
+    }
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceLib_Deinit(
+    OS_ConfigServiceLib_t* instance)
+{
+    if (!instance->isInitialized)
+    {
+        LOG_NOT_INITIALIZED(__func__);
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    // Try to release all backends, even if one of them fails.
+    OS_Error_t err = OS_ConfigServiceLib_flush(instance);
+
+    instance->isInitialized = false;
+
+    OS_ConfigServiceBackend_t* backends[] =
+    {
+        &instance->parameterBackend,
+        &instance->domainBackend,
+        &instance->stringBackend,
+        &instance->blobBackend,
+    };
+
+    for (unsigned int k = 0; k < sizeof(backends) / sizeof(backends[0]); ++k)
+    {
+        OS_Error_t deinitResult = OS_ConfigServiceBackend_deinitialize(backends[k]);
+        if (OS_SUCCESS != deinitResult)
+        {
+            Debug_LOG_ERROR("OS_ConfigServiceBackend_deinitialize() failed, error %d",
+                            deinitResult);
+            err = deinitResult;
+        }
+    }
+
+    return err;
+}
+
+//------------------------------------------------------------------------------
+// Moves the string or blob value of the given parameter to the first free
+// extent of its backend, if that lies before the current one. The parameter
+// record is committed before the old extent is released, so the value is
+// never lost on the way.
+static
+OS_Error_t
+OS_ConfigServiceLib_compactParameter(
+    OS_ConfigServiceLib_t* instance,
+    uint32_t parameterIndex,
+    bool* hasMoved)
+{
+    OS_ConfigServiceLibTypes_Parameter_t parameter;
+    OS_ConfigServiceBackend_t* backend;
+    OS_ConfigServiceExtentMap_t* map;
+    uint32_t index;
+    uint32_t numberOfRecords;
+
+    OS_Error_t err = OS_ConfigServiceLib_readParameter(
+                         instance,
+                         parameterIndex,
+                         &parameter);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_ERROR("OS_ConfigServiceLib_readParameter() failed, error %d", err);
+        return err;
+    }
+
+    switch (parameter.parameterType)
+    {
+    case OS_CONFIG_LIB_PARAMETER_TYPE_STRING:
+        backend = &instance->stringBackend;
+        map = &instance->stringExtents;
+        index = parameter.parameterValue.valueString.index;
+        numberOfRecords = OS_ConfigServiceLib_getNumberOfRecords(
+                              backend,
+                              parameter.parameterValue.valueString.size);
+        break;
+
+    case OS_CONFIG_LIB_PARAMETER_TYPE_BLOB:
+        backend = &instance->blobBackend;
+        map = &instance->blobExtents;
+        index = parameter.parameterValue.valueBlob.index;
+        numberOfRecords = parameter.parameterValue.valueBlob.numberOfBlocks;
+        break;
+
+    default:
+        return OS_SUCCESS;
+    }
+
+    uint32_t newIndex;
+
+    // Shared records would have to be updated in all parameters referring to
+    // them, so they stay where they are.
+    if ((0 == numberOfRecords) ||
+        OS_ConfigServiceExtentMap_isShared(map, index, numberOfRecords) ||
+        (OS_SUCCESS != OS_ConfigServiceExtentMap_find(
+             map,
+             numberOfRecords,
+             &newIndex)) ||
+        (newIndex >= index))
+    {
+        return OS_SUCCESS;
+    }
+
+    OS_ConfigServiceExtentMap_acquire(map, newIndex, numberOfRecords);
+
+    err = OS_ConfigServiceLib_copyRecords(
+              backend,
+              index,
+              newIndex,
+              numberOfRecords);
+    if (OS_SUCCESS == err)
+    {
+        if (OS_CONFIG_LIB_PARAMETER_TYPE_STRING == parameter.parameterType)
+        {
+            parameter.parameterValue.valueString.index = newIndex;
+        }
+        else
+        {
+            parameter.parameterValue.valueBlob.index = newIndex;
+        }
+
+        err = OS_ConfigServiceLib_writeParameter(
+                  instance,
+                  parameterIndex,
+                  &parameter);
+    }
+
+    if (OS_SUCCESS == err)
+    {
+        err = OS_ConfigServiceLib_flushParameter(instance, &parameter);
+    }
+
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        OS_ConfigServiceExtentMap_release(map, newIndex, numberOfRecords);
+        return err;
+    }
+
+    OS_ConfigServiceExtentMap_release(map, index, numberOfRecords);
+    *hasMoved = true;
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceLib_compact(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int maxParameters,
+    bool* isDone)
+{
+    if (!instance->isInitialized)
+    {
+        LOG_NOT_INITIALIZED(__func__);
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    unsigned int numberOfParameters = OS_ConfigServiceBackend_getNumberOfRecords(
+                                          &instance->parameterBackend);
+
+    *isDone = false;
+
+    for (unsigned int k = 0; k < maxParameters; ++k)
+    {
+        // A pass that moved something may have opened up room for values that
+        // were visited before, so passes are repeated until nothing moves.
+        if (instance->compactionCursor >= numberOfParameters)
+        {
+            bool hasMoved = instance->hasCompactionMoved;
+
+            instance->compactionCursor = 0;
+            instance->hasCompactionMoved = false;
+
+            if (!hasMoved)
+            {
+                *isDone = true;
+                return OS_SUCCESS;
+            }
+        }
+
+        OS_Error_t err = OS_ConfigServiceLib_compactParameter(
+                             instance,
+                             instance->compactionCursor,
+                             &instance->hasCompactionMoved);
+        if (OS_SUCCESS != err)
+        {
+            Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+            return err;
+        }
+
+        instance->compactionCursor++;
+    }
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceLib_getUsedRecords(
+    OS_ConfigServiceLib_t const* instance,
+    uint32_t* stringRecords,
+    uint32_t* blobRecords)
+{
+    if (!instance->isInitialized)
+    {
+        LOG_NOT_INITIALIZED(__func__);
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    if (!OS_ConfigServiceExtentMap_isValid(&instance->stringExtents) ||
+        !OS_ConfigServiceExtentMap_isValid(&instance->blobExtents))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_NOT_SUPPORTED;
+    }
+
+    *stringRecords = OS_ConfigServiceExtentMap_getEnd(&instance->stringExtents);
+    *blobRecords = OS_ConfigServiceExtentMap_getEnd(&instance->blobExtents);
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceLib_domainEnumeratorInit(
+    OS_ConfigServiceLib_t const* instance,
+    OS_ConfigServiceLibTypes_DomainEnumerator_t* enumerator)
+{
+    if (!instance->isInitialized)
+    {
+        LOG_NOT_INITIALIZED(__func__);
+        return OS_ERROR_INVALID_STATE;
+    }
+    OS_ConfigServiceLib_domainEnumeratorReset(instance, enumerator);
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceLib_domainEnumeratorClose(
+    OS_ConfigServiceLib_t const* instance,
+    OS_ConfigServiceLibTypes_DomainEnumerator_t* enumerator)
+{
+    if (!instance->isInitialized)
+    {
+        LOG_NOT_INITIALIZED(__func__);
+        return OS_ERROR_INVALID_STATE;
+    }
+    // No action required.
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceLib_domainEnumeratorReset(
+    OS_ConfigServiceLib_t const* instance,
+    OS_ConfigServiceLibTypes_DomainEnumerator_t* enumerator)
+{
+    if (!instance->isInitialized)
+    {
+        LOG_NOT_INITIALIZED(__func__);
+        return OS_ERROR_INVALID_STATE;
+    }
+    enumerator->index = 0;
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceLib_domainEnumeratorIncrement(
+    OS_ConfigServiceLib_t const* instance,
+    OS_ConfigServiceLibTypes_DomainEnumerator_t* enumerator)
+{
+    if (!instance->isInitialized)
+    {
+        LOG_NOT_INITIALIZED(__func__);
+        return OS_ERROR_INVALID_STATE;
+    }
+    // Store the packed index value in a temporary variable to avoid pointer
+    // misalignment.
+    uint32_t enumeratorIncrement = enumerator->index;
+
+    OS_Error_t err = OS_ConfigServiceLib_enumeratorRawIncrement(
+                         OS_ConfigServiceBackend_getNumberOfRecords(&instance->domainBackend),
+                         &enumeratorIncrement);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return err;
+    }
+
+    // Increment the index with successfully incremented temporary variable.
+    enumerator->index = enumeratorIncrement;
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceLib_domainEnumeratorGetElement(
+    OS_ConfigServiceLib_t* instance,
+    OS_ConfigServiceLibTypes_DomainEnumerator_t const* enumerator,
+    OS_ConfigServiceLibTypes_Domain_t* domain)
+{
+    if (!instance->isInitialized)
+    {
+        LOG_NOT_INITIALIZED(__func__);
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    OS_Error_t fetchResult = OS_ConfigServiceBackend_readRecord(
+                                 &instance->domainBackend,
+                                 enumerator->index,
+                                 domain,
+                                 sizeof(OS_ConfigServiceLibTypes_Domain_t));
+
+    if (OS_SUCCESS == fetchResult)
+    {
+        domain->enumerator = *enumerator;
+        return OS_SUCCESS;
+    }
+    else
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_GENERIC;
+    }
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceLib_parameterEnumeratorInit(
+    OS_ConfigServiceLib_t*  instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_DomainEnumerator_t const* domainEnumerator,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t* enumerator)
+{
+    if (!instance->isInitialized)
+    {
+        LOG_NOT_INITIALIZED(__func__);
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t initEnumerator;
+    OS_Error_t err;
+
+    initEnumerator.domainEnumerator = *domainEnumerator;
+    err = OS_ConfigServiceLib_parameterEnumeratorReset(
+              instance,
+              appId,
+              &initEnumerator);
+    if (OS_SUCCESS == err)
+    {
+        *enumerator = initEnumerator;
+    }
+
+    return err;
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceLib_parameterEnumeratorClose(
+    OS_ConfigServiceLib_t const* instance,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t* enumerator)
+{
+    if (!instance->isInitialized)
+    {
+        LOG_NOT_INITIALIZED(__func__);
+        return OS_ERROR_INVALID_STATE;
+    }
+    // No action required.
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// We start at the first parameter and starting from there try to find the first paramter of the given domain.
+// With a valid index, the search starts at the first parameter of the domain.
+OS_Error_t
+OS_ConfigServiceLib_parameterEnumeratorReset(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t* enumerator)
+{
+    if (!instance->isInitialized)
+    {
+        LOG_NOT_INITIALIZED(__func__);
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t searchEnumerator;
+    OS_Error_t err;
+
+    searchEnumerator.index = 0;
+    searchEnumerator.domainEnumerator = enumerator->domainEnumerator;
+    err = OS_ConfigServiceLib_advanceParameterEnumerator(
+              instance,
+              appId,
+              &searchEnumerator,
+              enumerator);
+    if (OS_SUCCESS == err)
+    {
+        *enumerator = searchEnumerator;
+    }
+
+    return err;
+}
+
+//------------------------------------------------------------------------------
+// We try to increment the given enumerator and start the search from there.
+// If no parameter was found the given enumerator is not changed.
+OS_Error_t OS_ConfigServiceLib_parameterEnumeratorIncrement(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t* enumerator)
+{
+    if (!instance->isInitialized)
+    {
+        LOG_NOT_INITIALIZED(__func__);
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t searchEnumerator = *enumerator;
+
+    if (OS_ConfigServiceIndex_isValid(&instance->index))
+    {
+        uint32_t position;
+        uint32_t parameterIndex;
+
+        if (!OS_ConfigServiceIndex_seekDomainParameter(
+                &instance->index,
+                searchEnumerator.domainEnumerator.index,
+                searchEnumerator.index,
+                &position))
+        {
+            Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+            return OS_ERROR_GENERIC;
+        }
+
+        // Usually the enumerator points to a parameter of its domain, then the
+        // next candidate directly follows it in the list of the domain.
+        if (OS_ConfigServiceIndex_getDomainParameter(
+                &instance->index,
+                searchEnumerator.domainEnumerator.index,
+                position,
+                &parameterIndex) &&
+            (parameterIndex == searchEnumerator.index))
+        {
+            position++;
+        }
+
+        OS_Error_t err = OS_ConfigServiceLib_findParamterInDomainList(
+                             instance,
+                             appId,
+                             &searchEnumerator,
+                             position);
+        if (OS_SUCCESS == err)
+        {
+            *enumerator = searchEnumerator;
+        }
+
+        return err;
+    }
+
+    if (OS_SUCCESS == OS_ConfigServiceLib_parameterEnumeratorRawIncrement(
+            instance,
+            &searchEnumerator))
+    {
+        OS_Error_t err = OS_ConfigServiceLib_advanceParameterEnumerator(
+                             instance,
+                             appId,
+                             &searchEnumerator,
+                             enumerator);
+        return err;
+    }
+    else
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_GENERIC;
+    }
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceLib_parameterEnumeratorGetElement(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    OS_ConfigServiceLibTypes_Parameter_t* parameter)
+{
+    if (!instance->isInitialized)
+    {
+        LOG_NOT_INITIALIZED(__func__);
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    OS_ConfigServiceLibTypes_Parameter_t retrievedParameter;
+
+    OS_Error_t fetchResult = OS_ConfigServiceLib_readParameter(
+                                 instance,
+                                 enumerator->index,
+                                 &retrievedParameter);
+
+    if (OS_SUCCESS != fetchResult)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_GENERIC;
+    }
+
+    // The enumerator comes from the caller, so it may point to any parameter.
+    if (!OS_ConfigServiceLib_ParameterIsVisibleFor(&retrievedParameter, appId))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_CONFIG_PARAMETER_NOT_FOUND;
+    }
+
+    *parameter = retrievedParameter;
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Extracts the domain name from the given domain.
+void
+OS_ConfigServiceLib_domainGetName(
+    OS_ConfigServiceLibTypes_Domain_t const* domain,
+    OS_ConfigServiceLibTypes_DomainName_t* domainName)
+{
+    *domainName = domain->name;
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceLib_domainCreateParameterEnumerator(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_Domain_t const* domain,
+    OS_ConfigServiceLibTypes_ParameterName_t const* parameterName,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t* parameterEnumerator)
+{
+    if (!instance->isInitialized)
+    {
+        LOG_NOT_INITIALIZED(__func__);
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t searchEnumerator;
+    OS_ConfigServiceLibTypes_Parameter_t searchParameter;
+
+    if (OS_ConfigServiceIndex_isValid(&instance->index))
+    {
+        return OS_ConfigServiceLib_lookupParameter(
+                   instance,
+                   appId,
+                   &domain->enumerator,
+                   parameterName,
+                   parameterEnumerator,
+                   &searchParameter);
+    }
+
+    OS_Error_t err = OS_ConfigServiceLib_parameterEnumeratorInit(
+                         instance,
+                         appId,
+                         &domain->enumerator,
+                         &searchEnumerator);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_GENERIC;
+    }
+
+    for (;;)
+    {
+        err = OS_ConfigServiceLib_parameterEnumeratorGetElement(
+                  instance,
+                  appId,
+                  &searchEnumerator,
+                  &searchParameter);
+        if (OS_SUCCESS != err)
+        {
+            Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+            return OS_ERROR_GENERIC;
+        }
+
+        if (OS_SUCCESS == OS_ConfigServiceLib_compareParameterName(
+                parameterName,
+                &searchParameter.parameterName))
+        {
+            *parameterEnumerator = searchEnumerator;
+            return OS_SUCCESS;
+        }
+        err = OS_ConfigServiceLib_parameterEnumeratorIncrement(
+                  instance,
+                  appId,
+                  &searchEnumerator);
+        if (OS_SUCCESS != err)
+        {
+            Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+            return OS_ERROR_GENERIC;
+        }
+    } // end for(;;)
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceLib_domainGetElement(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_Domain_t const* domain,
+    OS_ConfigServiceLibTypes_ParameterName_t const* parameterName,
+    OS_ConfigServiceLibTypes_Parameter_t* parameter)
+{
+    if (!instance->isInitialized)
+    {
+        LOG_NOT_INITIALIZED(__func__);
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t parameterEnumerator;
+    OS_ConfigServiceLibTypes_Parameter_t searchParameter;
+
+    OS_Error_t err = OS_ConfigServiceLib_domainCreateParameterEnumerator(
+                         instance,
+                         appId,
+                         domain,
+                         parameterName,
+                         &parameterEnumerator);
+
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_GENERIC;
+    }
+
+    err = OS_ConfigServiceLib_parameterEnumeratorGetElement(
+              instance,
+              appId,
+              &parameterEnumerator,
+              &searchParameter);
+    if (OS_SUCCESS == err)
+    {
+        *parameter = searchParameter;
+        return OS_SUCCESS;
+    }
+    else
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_GENERIC;
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+OS_ConfigServiceLib_parameterGetName(
+    OS_ConfigServiceLibTypes_Parameter_t const* parameter,
+    OS_ConfigServiceLibTypes_ParameterName_t* parameterName)
+{
+    *parameterName = parameter->parameterName;
+}
+
+//------------------------------------------------------------------------------
+void
+OS_ConfigServiceLib_parameterGetType(
+    OS_ConfigServiceLibTypes_Parameter_t const* parameter,
+    OS_ConfigServiceLibTypes_ParameterType_t* parameterType)
+{
+    *parameterType = parameter->parameterType;
+}
+
+//------------------------------------------------------------------------------
+size_t
+OS_ConfigServiceLib_parameterGetSize(
+    OS_ConfigServiceLibTypes_Parameter_t const* parameter)
+{
+    switch (parameter->parameterType)
+    {
+    case OS_CONFIG_LIB_PARAMETER_TYPE_INTEGER32:
+        return sizeof(uint32_t);
+        break;
+
+    case OS_CONFIG_LIB_PARAMETER_TYPE_INTEGER64:
+        return sizeof(uint64_t);
+        break;
+
+    case OS_CONFIG_LIB_PARAMETER_TYPE_STRING:
+        return parameter->parameterValue.valueString.size;
+        break;
+
+    case OS_CONFIG_LIB_PARAMETER_TYPE_BLOB:
+        return parameter->parameterValue.valueBlob.size;
+        break;
+
+    default:
+        return 0;
+        break;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Reads the record of the given parameter again, so only its index is taken
+// from the caller. Fails if the parameter is not visible for the given app.
+static
+OS_Error_t
+OS_ConfigServiceLib_rereadParameter(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_Parameter_t const* parameter,
+    OS_ConfigServiceLibTypes_Parameter_t* storedParameter)
+{
+    if (parameter->index >= OS_ConfigServiceBackend_getNumberOfRecords(
+            &instance->parameterBackend))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_CONFIG_PARAMETER_NOT_FOUND;
+    }
+
+    OS_Error_t err = OS_ConfigServiceLib_readParameter(
+                         instance,
+                         parameter->index,
+                         storedParameter);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return err;
+    }
+
+    if (!OS_ConfigServiceLib_ParameterIsVisibleFor(storedParameter, appId))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_CONFIG_PARAMETER_NOT_FOUND;
+    }
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Copies the value of a parameter read from the backend.
+static
+OS_Error_t
+OS_ConfigServiceLib_fetchValue(
+    OS_ConfigServiceLib_t* instance,
+    OS_ConfigServiceLibTypes_Parameter_t const* parameter,
+    void* buffer,
+    size_t bufferSize,
+    size_t* bytesCopied)
+{
+    size_t parameterSize = OS_ConfigServiceLib_parameterGetSize(parameter);
+    OS_Error_t err;
+
+    *bytesCopied = 0;
+
+    if (parameterSize > bufferSize)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    switch (parameter->parameterType)
+    {
+    case OS_CONFIG_LIB_PARAMETER_TYPE_INTEGER32:
+    case OS_CONFIG_LIB_PARAMETER_TYPE_INTEGER64:
+        memcpy(buffer, &parameter->parameterValue, parameterSize);
+        err = OS_SUCCESS;
+        break;
+
+    case OS_CONFIG_LIB_PARAMETER_TYPE_STRING:
+        err = OS_ConfigServiceLib_fetchVariableLengthString(
+                  &instance->stringBackend,
+                  parameter->parameterValue.valueString.index,
+                  parameterSize,
+                  buffer,
+                  bufferSize);
+        break;
+
+    case OS_CONFIG_LIB_PARAMETER_TYPE_BLOB:
+        err = OS_ConfigServiceLib_fetchVariableLengthBlob(
+                  &instance->blobBackend,
+                  parameterSize,
+                  parameter->parameterValue.valueBlob.index,
+                  parameter->parameterValue.valueBlob.numberOfBlocks,
+                  buffer,
+                  bufferSize);
+        break;
+
+    default:
+        err = OS_ERROR_GENERIC;
+        break;
+    }
+
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return err;
+    }
+
+    *bytesCopied = parameterSize;
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceLib_parameterGetValue(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_Parameter_t const* parameter,
+    void* buffer,
+    size_t bufferSize,
+    size_t* bytesCopied)
+{
+    if (!instance->isInitialized)
+    {
+        LOG_NOT_INITIALIZED(__func__);
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    OS_ConfigServiceLibTypes_Parameter_t storedParameter;
+
+    *bytesCopied = 0;
+
+    OS_Error_t err = OS_ConfigServiceLib_rereadParameter(
+                         instance,
+                         appId,
+                         parameter,
+                         &storedParameter);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return err;
+    }
+
+    return OS_ConfigServiceLib_fetchValue(
+               instance,
+               &storedParameter,
+               buffer,
+               bufferSize,
+               bytesCopied);
+}
+
+//------------------------------------------------------------------------------
+// Get the parameter value - specific format.
+OS_Error_t
+OS_ConfigServiceLib_parameterGetValueAsU32(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_Parameter_t const* parameter,
+    uint32_t* value)
+{
+    if (!instance->isInitialized)
+    {
+        LOG_NOT_INITIALIZED(__func__);
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    OS_ConfigServiceLibTypes_Parameter_t storedParameter;
+
+    OS_Error_t err = OS_ConfigServiceLib_rereadParameter(
+                         instance,
+                         appId,
+                         parameter,
+                         &storedParameter);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return err;
+    }
+
+    *value = storedParameter.parameterValue.valueInteger32;
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Get the parameter value - specific format.
+OS_Error_t
+OS_ConfigServiceLib_parameterGetValueAsU64(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_Parameter_t const* parameter,
+    uint64_t* value)
+{
+    if (!instance->isInitialized)
+    {
+        LOG_NOT_INITIALIZED(__func__);
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    OS_ConfigServiceLibTypes_Parameter_t storedParameter;
+
+    OS_Error_t err = OS_ConfigServiceLib_rereadParameter(
+                         instance,
+                         appId,
+                         parameter,
+                         &storedParameter);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return err;
+    }
+
+    *value = storedParameter.parameterValue.valueInteger64;
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Get the parameter value - specific format.
+OS_Error_t
+OS_ConfigServiceLib_parameterGetValueAsString(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_Parameter_t const* parameter,
+    char* buffer,
+    size_t bufferSize)
+{
+    if (!instance->isInitialized)
+    {
+        LOG_NOT_INITIALIZED(__func__);
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    size_t bytesCopied;
+
+    return OS_ConfigServiceLib_parameterGetValue(
+               instance,
+               appId,
+               parameter,
+               buffer,
+               bufferSize,
+               &bytesCopied);
+}
+
+//------------------------------------------------------------------------------
+// Get the parameter value - specific format.
+OS_Error_t
+OS_ConfigServiceLib_parameterGetValueAsBlob(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_Parameter_t const* parameter,
+    void* buffer,
+    size_t bufferSize)
+{
+    if (!instance->isInitialized)
+    {
+        LOG_NOT_INITIALIZED(__func__);
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    size_t bytesCopied;
+
+    return OS_ConfigServiceLib_parameterGetValue(
+               instance,
+               appId,
+               parameter,
+               buffer,
+               bufferSize,
+               &bytesCopied);
+}
+
+//------------------------------------------------------------------------------
+// The record of the parameter is read again, so the pointer refers to the value
+// stored now and not to the one the caller has seen.
+OS_Error_t
+OS_ConfigServiceLib_parameterGetValuePointer(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_Parameter_t const* parameter,
+    void const** value,
+    size_t* valueSize)
+{
+    if (!instance->isInitialized)
+    {
+        LOG_NOT_INITIALIZED(__func__);
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    OS_ConfigServiceLibTypes_Parameter_t storedParameter;
+
+    OS_Error_t err = OS_ConfigServiceLib_rereadParameter(
+                         instance,
+                         appId,
+                         parameter,
+                         &storedParameter);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return err;
+    }
+
+    switch (storedParameter.parameterType)
+    {
+    case OS_CONFIG_LIB_PARAMETER_TYPE_STRING:
+        err = OS_ConfigServiceBackend_getRecordPointer(
+                  &instance->stringBackend,
+                  storedParameter.parameterValue.valueString.index,
+                  OS_ConfigServiceLib_getNumberOfRecords(
+                      &instance->stringBackend,
+                      storedParameter.parameterValue.valueString.size),
+                  value);
+        break;
+
+    case OS_CONFIG_LIB_PARAMETER_TYPE_BLOB:
+        err = OS_ConfigServiceBackend_getRecordPointer(
+                  &instance->blobBackend,
+                  storedParameter.parameterValue.valueBlob.index,
+                  storedParameter.parameterValue.valueBlob.numberOfBlocks,
+                  value);
+        break;
+
+    // Integers are decoded from the parameter record, there is nothing in the
+    // backend to point to.
+    case OS_CONFIG_LIB_PARAMETER_TYPE_INTEGER32:
+    case OS_CONFIG_LIB_PARAMETER_TYPE_INTEGER64:
+        err = OS_ERROR_NOT_SUPPORTED;
+        break;
+
+    default:
+        err = OS_ERROR_INVALID_PARAMETER;
+        break;
+    }
+
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return err;
+    }
+
+    *valueSize = OS_ConfigServiceLib_parameterGetSize(&storedParameter);
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Checks whether the given value can be written to the given parameter, so a
+// write does not fail half way for reasons known in advance.
+static
+OS_Error_t
+OS_ConfigServiceLib_parameterCheckValue(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_Parameter_t const* parameter,
+    OS_ConfigServiceLibTypes_ParameterType_t parameterType,
+    size_t bufferSize)
+{
+    if (!OS_ConfigServiceLib_ParameterIsWriteableFor(parameter, appId))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_GENERIC;
+    }
+
+    if (parameterType != parameter->parameterType)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_GENERIC;
+    }
+
+    switch (parameter->parameterType)
+    {
+    case OS_CONFIG_LIB_PARAMETER_TYPE_INTEGER32:
+    case OS_CONFIG_LIB_PARAMETER_TYPE_INTEGER64:
+        if (OS_ConfigServiceLib_parameterGetSize(parameter) != bufferSize)
+        {
+            Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+            return OS_ERROR_GENERIC;
+        }
+        break;
+
+    case OS_CONFIG_LIB_PARAMETER_TYPE_STRING:
+    {
+        if (bufferSize > OS_CONFIG_LIB_PARAMETER_MAX_STRING_VALUE_SIZE)
+        {
+            Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+            return OS_ERROR_GENERIC;
+        }
+
+        // A string that outgrows or shares its records needs a free extent to
+        // move to.
+        uint32_t numberOfRecords = OS_ConfigServiceLib_getNumberOfRecords(
+                                       &instance->stringBackend,
+                                       bufferSize);
+        uint32_t oldRecords = OS_ConfigServiceLib_getNumberOfRecords(
+                                  &instance->stringBackend,
+                                  parameter->parameterValue.valueString.size);
+        uint32_t firstIndex;
+
+        if (((numberOfRecords > oldRecords) ||
+             OS_ConfigServiceExtentMap_isShared(
+                 &instance->stringExtents,
+                 parameter->parameterValue.valueString.index,
+                 oldRecords)) &&
+            (OS_SUCCESS != OS_ConfigServiceExtentMap_find(
+                 &instance->stringExtents,
+                 numberOfRecords,
+                 &firstIndex)))
+        {
+            Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+            return OS_ERROR_INSUFFICIENT_SPACE;
+        }
+    }
+    break;
+
+    case OS_CONFIG_LIB_PARAMETER_TYPE_BLOB:
+    {
+        // A blob that outgrows or shares its blocks needs a free extent to
+        // move to.
+        uint32_t numberOfBlocks;
+        uint32_t firstIndex;
+
+        OS_Error_t err = OS_ConfigServiceLib_getNumberOfBlobBlocks(
+                             instance,
+                             bufferSize,
+                             &numberOfBlocks);
+        if (OS_SUCCESS != err)
+        {
+            Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+            return err;
+        }
+
+        if (OS_ConfigServiceLib_isBlobMoving(
+                instance,
+                parameter,
+                numberOfBlocks) &&
+            (OS_SUCCESS != OS_ConfigServiceExtentMap_find(
+                 &instance->blobExtents,
+                 numberOfBlocks,
+                 &firstIndex)))
+        {
+            Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+            return OS_ERROR_INSUFFICIENT_SPACE;
+        }
+    }
+    break;
+
+    default:
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_GENERIC;
+    }
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Writes the value of a checked parameter, the payload first and the parameter
+// record last. The records are not committed to the storage.
+static
+OS_Error_t
+OS_ConfigServiceLib_parameterWriteValue(
+    OS_ConfigServiceLib_t* instance,
+    uint32_t parameterIndex,
+    OS_ConfigServiceLibTypes_Parameter_t* parameter,
+    void const* buffer,
+    size_t bufferSize)
+{
+    OS_ConfigServiceLibTypes_Parameter_t oldParameter = *parameter;
+    OS_Error_t err;
+
+#if defined(OS_CONFIG_SERVICE_DEDUP)
+    uint32_t hash = OS_ConfigServiceDedup_hash(
+                        OS_CONFIG_SERVICE_DEDUP_HASH_INIT,
+                        buffer,
+                        bufferSize);
+
+    // A value that is stored already only needs the parameter record. The
+    // old value is released once the record is written, otherwise the stored
+    // copy is.
+    if (OS_ConfigServiceLib_shareValue(
+            instance,
+            parameter,
+            buffer,
+            bufferSize,
+            hash))
+    {
+        err = OS_ConfigServiceLib_writeParameter(
+                  instance,
+                  parameterIndex,
+                  parameter);
+
+        OS_ConfigServiceLib_releaseValue(
+            instance,
+            (OS_SUCCESS == err) ? &oldParameter : parameter);
+
+        return err;
+    }
+#endif
+
+    switch (parameter->parameterType)
+    {
+    case OS_CONFIG_LIB_PARAMETER_TYPE_INTEGER32:
+    case OS_CONFIG_LIB_PARAMETER_TYPE_INTEGER64:
+        if (OS_ConfigServiceLib_parameterGetSize(parameter) != bufferSize)
+        {
+            Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+            err = OS_ERROR_GENERIC;
+            break;
+        }
+        memcpy(&parameter->parameterValue, buffer, bufferSize);
+        err = OS_SUCCESS;
+        break;
+
+    case OS_CONFIG_LIB_PARAMETER_TYPE_STRING:
+        err = OS_ConfigServiceLib_writeVariableLengthString(
+                  instance,
+                  parameter,
+                  buffer,
+                  bufferSize);
+        break;
+
+    case OS_CONFIG_LIB_PARAMETER_TYPE_BLOB:
+    {
+        uint32_t numberOfBlocks;
+
+        err = OS_ConfigServiceLib_getNumberOfBlobBlocks(
+                  instance,
+                  bufferSize,
+                  &numberOfBlocks);
+
+        // The old value is overwritten, so nothing is taken along.
+        if ((OS_SUCCESS == err) &&
+            OS_ConfigServiceLib_isBlobMoving(
+                instance,
+                parameter,
+                numberOfBlocks))
+        {
+            err = OS_ConfigServiceLib_resizeBlobExtent(
+                      instance,
+                      parameter,
+                      numberOfBlocks,
+                      0);
+        }
+
+        if (OS_SUCCESS == err)
+        {
+            parameter->parameterValue.valueBlob.size = (uint32_t)bufferSize;
+
+            err = OS_ConfigServiceLib_writeVariableLength(
+                      &instance->blobBackend,
+                      parameter->parameterValue.valueBlob.index,
+                      parameter->parameterValue.valueBlob.numberOfBlocks,
+                      buffer,
+                      bufferSize);
+        }
+    }
+    break;
+
+    default:
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        err = OS_ERROR_GENERIC;
+        break;
+    }
+
+    if (OS_SUCCESS == err)
+    {
+#if defined(OS_CONFIG_SERVICE_DEDUP)
+        OS_ConfigServiceLib_rememberValue(instance, parameter, hash);
+#endif
+        err = OS_ConfigServiceLib_writeParameter(
+                  instance,
+                  parameterIndex,
+                  parameter);
+    }
+    else
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        err = OS_ERROR_GENERIC;
+    }
+
+    // The old records are released only once the parameter record no longer
+    // refers to them, otherwise the records taken for the new value are.
+    if (OS_SUCCESS == err)
+    {
+        OS_ConfigServiceLib_releaseReplacedValue(
+            instance,
+            parameter,
+            &oldParameter);
+    }
+    else
+    {
+        OS_ConfigServiceLib_releaseReplacedValue(
+            instance,
+            &oldParameter,
+            parameter);
+    }
+
+    return err;
+}
+
+//------------------------------------------------------------------------------
+// Set the parameter value - raw format.
+OS_Error_t
+OS_ConfigServiceLib_parameterSetValue(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    OS_ConfigServiceLibTypes_ParameterType_t parameterType,
+    void const* buffer,
+    size_t bufferSize)
+{
+    if (!instance->isInitialized)
+    {
+        LOG_NOT_INITIALIZED(__func__);
         return OS_ERROR_INVALID_STATE;
     }
-    OS_ConfigServiceLib_domainEnumeratorReset(instance, enumerator);
-    return OS_SUCCESS;
+
+    OS_ConfigServiceLibTypes_Parameter_t parameter;
+
+    // Fetch the parameter pointed to by the enumerator.
+    // Check the parameter type to be written is correct.
+    // All integral types: handling is straight forward.
+    // String and blob: check the given size is ok and
+    // which may be smaller than the maximum record size.
+
+    OS_Error_t err = OS_ConfigServiceLib_parameterEnumeratorGetElement(
+                         instance,
+                         appId,
+                         enumerator,
+                         &parameter);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_GENERIC;
+    }
+
+    err = OS_ConfigServiceLib_parameterCheckValue(
+              instance,
+              appId,
+              &parameter,
+              parameterType,
+              bufferSize);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return err;
+    }
+
+    err = OS_ConfigServiceLib_parameterWriteValue(
+              instance,
+              enumerator->index,
+              &parameter,
+              buffer,
+              bufferSize);
+
+    if (OS_SUCCESS == err)
+    {
+        err = OS_ConfigServiceLib_flushParameter(instance, &parameter);
+    }
+
+    return err;
 }
 
 //------------------------------------------------------------------------------
+// Set the parameter value - specific format.
 OS_Error_t
-OS_ConfigServiceLib_domainEnumeratorClose(
-    OS_ConfigServiceLib_t const* instance,
-    OS_ConfigServiceLibTypes_DomainEnumerator_t* enumerator)
+OS_ConfigServiceLib_parameterSetValueAsU32(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    uint32_t value)
 {
     if (!instance->isInitialized)
     {
         LOG_NOT_INITIALIZED(__func__);
         return OS_ERROR_INVALID_STATE;
     }
-    // No action required.
-    return OS_SUCCESS;
+
+    return OS_ConfigServiceLib_parameterSetValue(
+               instance,
+               appId,
+               enumerator,
+               OS_CONFIG_LIB_PARAMETER_TYPE_INTEGER32,
+               &value,
+               sizeof(uint32_t));
 }
 
 //------------------------------------------------------------------------------
+// Set the parameter value - specific format.
 OS_Error_t
-OS_ConfigServiceLib_domainEnumeratorReset(
-    OS_ConfigServiceLib_t const* instance,
-    OS_ConfigServiceLibTypes_DomainEnumerator_t* enumerator)
+OS_ConfigServiceLib_parameterSetValueAsU64(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    uint64_t value)
 {
     if (!instance->isInitialized)
     {
         LOG_NOT_INITIALIZED(__func__);
         return OS_ERROR_INVALID_STATE;
     }
-    enumerator->index = 0;
-    return OS_SUCCESS;
+
+    return OS_ConfigServiceLib_parameterSetValue(
+               instance,
+               appId,
+               enumerator,
+               OS_CONFIG_LIB_PARAMETER_TYPE_INTEGER64,
+               &value,
+               sizeof(uint64_t));
 }
 
 //------------------------------------------------------------------------------
+// Set the parameter value - specific format.
 OS_Error_t
-OS_ConfigServiceLib_domainEnumeratorIncrement(
-    OS_ConfigServiceLib_t const* instance,
-    OS_ConfigServiceLibTypes_DomainEnumerator_t* enumerator)
+OS_ConfigServiceLib_parameterSetValueAsString(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    OS_ConfigServiceLibTypes_ParameterType_t parameterType,
+    char const* buffer,
+    size_t bufferSize)
 {
     if (!instance->isInitialized)
     {
         LOG_NOT_INITIALIZED(__func__);
         return OS_ERROR_INVALID_STATE;
     }
-    // Store the packed index value in a temporary variable to avoid pointer
-    // misalignment.
-    uint32_t enumeratorIncrement = enumerator->index;
-
-    OS_Error_t err = OS_ConfigServiceLib_enumeratorRawIncrement(
-                         OS_ConfigServiceBackend_getNumberOfRecords(&instance->domainBackend),
-                         &enumeratorIncrement);
-    if (OS_SUCCESS != err)
-    {
-        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
-        return err;
-    }
 
-    // Increment the index with successfully incremented temporary variable.
-    enumerator->index = enumeratorIncrement;
-    return OS_SUCCESS;
+    return OS_ConfigServiceLib_parameterSetValue(
+               instance,
+               appId,
+               enumerator,
+               OS_CONFIG_LIB_PARAMETER_TYPE_STRING,
+               buffer,
+               bufferSize);
 }
 
 //------------------------------------------------------------------------------
+// Set the parameter value - specific format.
 OS_Error_t
-OS_ConfigServiceLib_domainEnumeratorGetElement(
+OS_ConfigServiceLib_parameterSetValueAsBlob(
     OS_ConfigServiceLib_t* instance,
-    OS_ConfigServiceLibTypes_DomainEnumerator_t const* enumerator,
-    OS_ConfigServiceLibTypes_Domain_t* domain)
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    OS_ConfigServiceLibTypes_ParameterType_t parameterType,
+    void const* buffer,
+    size_t bufferSize)
 {
     if (!instance->isInitialized)
     {
@@ -506,30 +3224,25 @@ OS_ConfigServiceLib_domainEnumeratorGetElement(
         return OS_ERROR_INVALID_STATE;
     }
 
-    OS_Error_t fetchResult = OS_ConfigServiceBackend_readRecord(
-                                 &instance->domainBackend,
-                                 enumerator->index,
-                                 domain,
-                                 sizeof(OS_ConfigServiceLibTypes_Domain_t));
-
-    if (OS_SUCCESS == fetchResult)
-    {
-        domain->enumerator = *enumerator;
-        return OS_SUCCESS;
-    }
-    else
-    {
-        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
-        return OS_ERROR_GENERIC;
-    }
+    return OS_ConfigServiceLib_parameterSetValue(
+               instance,
+               appId,
+               enumerator,
+               OS_CONFIG_LIB_PARAMETER_TYPE_BLOB,
+               buffer,
+               bufferSize);
 }
 
 //------------------------------------------------------------------------------
 OS_Error_t
-OS_ConfigServiceLib_parameterEnumeratorInit(
-    OS_ConfigServiceLib_t*  instance,
-    OS_ConfigServiceLibTypes_DomainEnumerator_t const* domainEnumerator,
-    OS_ConfigServiceLibTypes_ParameterEnumerator_t* enumerator)
+OS_ConfigServiceLib_parameterReadBlobRange(
+    OS_ConfigServiceLib_t* instance,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    size_t offset,
+    void* buffer,
+    size_t length,
+    size_t* bytesCopied)
 {
     if (!instance->isInitialized)
     {
@@ -537,42 +3250,69 @@ OS_ConfigServiceLib_parameterEnumeratorInit(
         return OS_ERROR_INVALID_STATE;
     }
 
-    OS_ConfigServiceLibTypes_ParameterEnumerator_t initEnumerator;
-    OS_Error_t err;
+    OS_ConfigServiceLibTypes_Parameter_t parameter;
 
-    initEnumerator.domainEnumerator = *domainEnumerator;
-    err = OS_ConfigServiceLib_parameterEnumeratorReset(
-              instance,
-              &initEnumerator);
-    if (OS_SUCCESS == err)
+    *bytesCopied = 0;
+
+    OS_Error_t err = OS_ConfigServiceLib_parameterEnumeratorGetElement(
+                         instance,
+                         appId,
+                         enumerator,
+                         &parameter);
+    if (OS_SUCCESS != err)
     {
-        *enumerator = initEnumerator;
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return err;
     }
 
-    return err;
-}
+    if (OS_CONFIG_LIB_PARAMETER_TYPE_BLOB != parameter.parameterType)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_CONFIG_TYPE_MISMATCH;
+    }
 
-//------------------------------------------------------------------------------
-OS_Error_t
-OS_ConfigServiceLib_parameterEnumeratorClose(
-    OS_ConfigServiceLib_t const* instance,
-    OS_ConfigServiceLibTypes_ParameterEnumerator_t* enumerator)
-{
-    if (!instance->isInitialized)
+    size_t blobSize = parameter.parameterValue.valueBlob.size;
+
+    if (offset > blobSize)
     {
-        LOG_NOT_INITIALIZED(__func__);
-        return OS_ERROR_INVALID_STATE;
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
     }
-    // No action required.
+
+    // Reading beyond the end of the blob is cut short.
+    if (length > blobSize - offset)
+    {
+        length = blobSize - offset;
+    }
+
+    err = OS_ConfigServiceLib_readRecordRange(
+              &instance->blobBackend,
+              parameter.parameterValue.valueBlob.index,
+              parameter.parameterValue.valueBlob.numberOfBlocks,
+              offset,
+              buffer,
+              length);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return err;
+    }
+
+    *bytesCopied = length;
+
     return OS_SUCCESS;
 }
 
 //------------------------------------------------------------------------------
-// We start at the first parameter and starting from there try to find the first paramter of the given domain.
 OS_Error_t
-OS_ConfigServiceLib_parameterEnumeratorReset(
+OS_ConfigServiceLib_parameterWriteBlobRange(
     OS_ConfigServiceLib_t* instance,
-    OS_ConfigServiceLibTypes_ParameterEnumerator_t* enumerator)
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    size_t blobSize,
+    size_t offset,
+    void const* buffer,
+    size_t length)
 {
     if (!instance->isInitialized)
     {
@@ -580,29 +3320,133 @@ OS_ConfigServiceLib_parameterEnumeratorReset(
         return OS_ERROR_INVALID_STATE;
     }
 
-    OS_ConfigServiceLibTypes_ParameterEnumerator_t searchEnumerator;
-    OS_Error_t err;
+    // The size is stored in 32 bits.
+    if ((blobSize > UINT32_MAX) ||
+        (offset > blobSize) || (length > blobSize - offset))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
 
-    searchEnumerator.index = 0;
-    searchEnumerator.domainEnumerator = enumerator->domainEnumerator;
-    err = OS_ConfigServiceLib_advanceParameterEnumerator(
+    OS_ConfigServiceLibTypes_Parameter_t parameter;
+
+    OS_Error_t err = OS_ConfigServiceLib_parameterEnumeratorGetElement(
+                         instance,
+                         appId,
+                         enumerator,
+                         &parameter);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_GENERIC;
+    }
+
+    err = OS_ConfigServiceLib_parameterCheckValue(
               instance,
-              &searchEnumerator,
-              enumerator);
-    if (OS_SUCCESS == err)
+              appId,
+              &parameter,
+              OS_CONFIG_LIB_PARAMETER_TYPE_BLOB,
+              blobSize);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return err;
+    }
+
+    // A blob that moves takes its current content along, as the other chunks
+    // of the new value may already be written.
+    OS_ConfigServiceLibTypes_Parameter_t oldParameter = parameter;
+    uint32_t numberOfBlocks;
+
+    err = OS_ConfigServiceLib_getNumberOfBlobBlocks(
+              instance,
+              blobSize,
+              &numberOfBlocks);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return err;
+    }
+
+    if (OS_ConfigServiceLib_isBlobMoving(
+            instance,
+            &parameter,
+            numberOfBlocks))
+    {
+        err = OS_ConfigServiceLib_resizeBlobExtent(
+                  instance,
+                  &parameter,
+                  numberOfBlocks,
+                  OS_ConfigServiceLib_getNumberOfRecords(
+                      &instance->blobBackend,
+                      parameter.parameterValue.valueBlob.size));
+        if (OS_SUCCESS != err)
+        {
+            Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+            return err;
+        }
+    }
+
+    // Whatever size is claimed, the blob has to fit into its blocks.
+    if (!OS_ConfigServiceLib_isRangeInRecords(
+            &instance->blobBackend,
+            parameter.parameterValue.valueBlob.numberOfBlocks,
+            0,
+            blobSize))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        err = OS_ERROR_INVALID_PARAMETER;
+    }
+    else
+    {
+        err = OS_ConfigServiceLib_writeRecordRange(
+                  &instance->blobBackend,
+                  parameter.parameterValue.valueBlob.index,
+                  parameter.parameterValue.valueBlob.numberOfBlocks,
+                  offset,
+                  buffer,
+                  length);
+    }
+
+    // The parameter record only changes with the size or location of the blob.
+    if ((OS_SUCCESS == err) &&
+        ((parameter.parameterValue.valueBlob.size != blobSize) ||
+         (parameter.parameterValue.valueBlob.index !=
+          oldParameter.parameterValue.valueBlob.index)))
+    {
+        parameter.parameterValue.valueBlob.size = (uint32_t)blobSize;
+
+        err = OS_ConfigServiceLib_writeParameter(
+                  instance,
+                  enumerator->index,
+                  &parameter);
+    }
+
+    if (OS_SUCCESS != err)
     {
-        *enumerator = searchEnumerator;
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        OS_ConfigServiceLib_releaseReplacedValue(
+            instance,
+            &oldParameter,
+            &parameter);
+        return err;
     }
 
-    return err;
+    OS_ConfigServiceLib_releaseReplacedValue(
+        instance,
+        &parameter,
+        &oldParameter);
+
+    return OS_ConfigServiceLib_flushParameter(instance, &parameter);
 }
 
 //------------------------------------------------------------------------------
-// We try to increment the given enumerator and start the search from there.
-// If no parameter was found the given enumerator is not changed.
-OS_Error_t OS_ConfigServiceLib_parameterEnumeratorIncrement(
+OS_Error_t
+OS_ConfigServiceLib_parameterResizeBlob(
     OS_ConfigServiceLib_t* instance,
-    OS_ConfigServiceLibTypes_ParameterEnumerator_t* enumerator)
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    size_t capacity)
 {
     if (!instance->isInitialized)
     {
@@ -610,92 +3454,120 @@ OS_Error_t OS_ConfigServiceLib_parameterEnumeratorIncrement(
         return OS_ERROR_INVALID_STATE;
     }
 
-    OS_ConfigServiceLibTypes_ParameterEnumerator_t searchEnumerator = *enumerator;
+    OS_ConfigServiceLibTypes_Parameter_t parameter;
 
-    if (OS_SUCCESS == OS_ConfigServiceLib_parameterEnumeratorRawIncrement(
-            instance,
-            &searchEnumerator))
+    OS_Error_t err = OS_ConfigServiceLib_parameterEnumeratorGetElement(
+                         instance,
+                         appId,
+                         enumerator,
+                         &parameter);
+    if (OS_SUCCESS != err)
     {
-        OS_Error_t err = OS_ConfigServiceLib_advanceParameterEnumerator(
-                             instance,
-                             &searchEnumerator,
-                             enumerator);
-        return err;
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_GENERIC;
     }
-    else
+
+    if (OS_CONFIG_LIB_PARAMETER_TYPE_BLOB != parameter.parameterType)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_CONFIG_TYPE_MISMATCH;
+    }
+
+    if (!OS_ConfigServiceLib_ParameterIsWriteableFor(&parameter, appId))
     {
         Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
         return OS_ERROR_GENERIC;
     }
-}
 
-//------------------------------------------------------------------------------
-OS_Error_t
-OS_ConfigServiceLib_parameterEnumeratorGetElement(
-    OS_ConfigServiceLib_t* instance,
-    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
-    OS_ConfigServiceLibTypes_Parameter_t* parameter)
-{
-    if (!instance->isInitialized)
+    uint32_t numberOfBlocks;
+
+    err = OS_ConfigServiceLib_getNumberOfBlobBlocks(
+              instance,
+              capacity,
+              &numberOfBlocks);
+    if (OS_SUCCESS != err)
     {
-        LOG_NOT_INITIALIZED(__func__);
-        return OS_ERROR_INVALID_STATE;
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return err;
     }
 
-    OS_ConfigServiceLibTypes_Parameter_t retrievedParameter;
+    OS_ConfigServiceLibTypes_Parameter_t oldParameter = parameter;
 
-    OS_Error_t fetchResult = OS_ConfigServiceBackend_readRecord(
-                                 &instance->parameterBackend,
-                                 enumerator->index,
-                                 &retrievedParameter,
-                                 sizeof(OS_ConfigServiceLibTypes_Parameter_t));
+    // A blob that does not fit into the new capacity is cut short.
+    if (parameter.parameterValue.valueBlob.size > capacity)
+    {
+        parameter.parameterValue.valueBlob.size = (uint32_t)capacity;
+    }
 
-    if (OS_SUCCESS == fetchResult)
+    err = OS_ConfigServiceLib_resizeBlobExtent(
+              instance,
+              &parameter,
+              numberOfBlocks,
+              OS_ConfigServiceLib_getNumberOfRecords(
+                  &instance->blobBackend,
+                  parameter.parameterValue.valueBlob.size));
+    if (OS_SUCCESS != err)
     {
-        *parameter = retrievedParameter;
-        return OS_SUCCESS;
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return err;
     }
-    else
+
+    err = OS_ConfigServiceLib_writeParameter(
+              instance,
+              enumerator->index,
+              &parameter);
+    if (OS_SUCCESS != err)
     {
         Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
-        return OS_ERROR_GENERIC;
+        OS_ConfigServiceLib_releaseReplacedValue(
+            instance,
+            &oldParameter,
+            &parameter);
+        return err;
     }
-}
 
-//------------------------------------------------------------------------------
-// Extracts the domain name from the given domain.
-void
-OS_ConfigServiceLib_domainGetName(
-    OS_ConfigServiceLibTypes_Domain_t const* domain,
-    OS_ConfigServiceLibTypes_DomainName_t* domainName)
-{
-    *domainName = domain->name;
+    OS_ConfigServiceLib_releaseReplacedValue(
+        instance,
+        &parameter,
+        &oldParameter);
+
+    return OS_ConfigServiceLib_flushParameter(instance, &parameter);
 }
 
 //------------------------------------------------------------------------------
+static
 OS_Error_t
-OS_ConfigServiceLib_domainCreateParameterEnumerator(
+find_parameter(
     OS_ConfigServiceLib_t* instance,
-    OS_ConfigServiceLibTypes_Domain_t const* domain,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_DomainEnumerator_t* domainEnumerator,
     OS_ConfigServiceLibTypes_ParameterName_t const* parameterName,
-    OS_ConfigServiceLibTypes_ParameterEnumerator_t* parameterEnumerator)
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t* parameterEnumerator,
+    OS_ConfigServiceLibTypes_Parameter_t* parameter)
 {
-    if (!instance->isInitialized)
+    OS_Error_t err;
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t paramEnumerator = {0};
+
+    if (OS_ConfigServiceIndex_isValid(&instance->index))
     {
-        LOG_NOT_INITIALIZED(__func__);
-        return OS_ERROR_INVALID_STATE;
+        return OS_ConfigServiceLib_lookupParameter(
+                   instance,
+                   appId,
+                   domainEnumerator,
+                   parameterName,
+                   parameterEnumerator,
+                   parameter);
     }
 
-    OS_ConfigServiceLibTypes_ParameterEnumerator_t searchEnumerator;
-    OS_ConfigServiceLibTypes_Parameter_t searchParameter;
-
-    OS_Error_t err = OS_ConfigServiceLib_parameterEnumeratorInit(
-                         instance,
-                         &domain->enumerator,
-                         &searchEnumerator);
-    if (OS_SUCCESS != err)
+    err = OS_ConfigServiceLib_parameterEnumeratorInit(
+              instance,
+              appId,
+              domainEnumerator,
+              &paramEnumerator);
+    if (0 != err)
     {
-        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        Debug_LOG_ERROR("OS_ConfigServiceLib_parameterEnumeratorInit() failed, err %d",
+                        err);
         return OS_ERROR_GENERIC;
     }
 
@@ -703,129 +3575,137 @@ OS_ConfigServiceLib_domainCreateParameterEnumerator(
     {
         err = OS_ConfigServiceLib_parameterEnumeratorGetElement(
                   instance,
-                  &searchEnumerator,
-                  &searchParameter);
-        if (OS_SUCCESS != err)
+                  appId,
+                  &paramEnumerator,
+                  parameter);
+        if (0 != err)
         {
-            Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+            Debug_LOG_ERROR("OS_ConfigServiceLib_parameterEnumeratorGetElement() failed, err %d",
+                            err);
             return OS_ERROR_GENERIC;
         }
 
+        OS_ConfigServiceLibTypes_ParameterName_t parameterNameTmp;
+        OS_ConfigServiceLib_parameterGetName(parameter, &parameterNameTmp);
         if (OS_SUCCESS == OS_ConfigServiceLib_compareParameterName(
-                parameterName,
-                &searchParameter.parameterName))
+                &parameterNameTmp,
+                parameterName))
         {
-            *parameterEnumerator = searchEnumerator;
+            // enumerator holds the right paramter
+            *parameterEnumerator = paramEnumerator;
             return OS_SUCCESS;
         }
+
         err = OS_ConfigServiceLib_parameterEnumeratorIncrement(
                   instance,
-                  &searchEnumerator);
-        if (OS_SUCCESS != err)
+                  appId,
+                  &paramEnumerator);
+        if (0 != err)
         {
-            Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+            Debug_LOG_ERROR("OS_ConfigServiceLib_parameterEnumeratorIncrement() failed, err %d",
+                            err);
             return OS_ERROR_GENERIC;
         }
     } // end for(;;)
 }
 
 //------------------------------------------------------------------------------
+static
 OS_Error_t
-OS_ConfigServiceLib_domainGetElement(
+find_domain(
     OS_ConfigServiceLib_t* instance,
-    OS_ConfigServiceLibTypes_Domain_t const* domain,
-    OS_ConfigServiceLibTypes_ParameterName_t const* parameterName,
-    OS_ConfigServiceLibTypes_Parameter_t* parameter)
+    OS_ConfigServiceLibTypes_DomainEnumerator_t* enumerator,
+    OS_ConfigServiceLibTypes_DomainName_t const* domainName)
 {
-    if (!instance->isInitialized)
-    {
-        LOG_NOT_INITIALIZED(__func__);
-        return OS_ERROR_INVALID_STATE;
-    }
-
-    OS_ConfigServiceLibTypes_ParameterEnumerator_t parameterEnumerator;
-    OS_ConfigServiceLibTypes_Parameter_t searchParameter;
-
-    OS_Error_t err = OS_ConfigServiceLib_domainCreateParameterEnumerator(
-                         instance,
-                         domain,
-                         parameterName,
-                         &parameterEnumerator);
-
+    OS_Error_t err = OS_ConfigServiceLib_domainEnumeratorInit(instance,
+                                                              enumerator);
     if (OS_SUCCESS != err)
     {
-        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
-        return OS_ERROR_GENERIC;
+        return err;
     }
 
-    err = OS_ConfigServiceLib_parameterEnumeratorGetElement(
-              instance,
-              &parameterEnumerator,
-              &searchParameter);
-    if (OS_SUCCESS == err)
-    {
-        *parameter = searchParameter;
-        return OS_SUCCESS;
-    }
-    else
+    if (OS_ConfigServiceIndex_isValid(&instance->index))
     {
-        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        OS_ConfigServiceIndex_Cursor_t cursor;
+        uint32_t domainIndex;
+
+        OS_ConfigServiceIndex_beginDomainLookup(
+            &instance->index,
+            domainName,
+            &cursor);
+
+        while (OS_ConfigServiceIndex_nextDomain(
+                   &instance->index,
+                   &cursor,
+                   &domainIndex))
+        {
+            enumerator->index = domainIndex;
+
+            OS_ConfigServiceLibTypes_Domain_t domain;
+            err = OS_ConfigServiceLib_domainEnumeratorGetElement(
+                      instance,
+                      enumerator,
+                      &domain);
+            if (0 != err)
+            {
+                Debug_LOG_ERROR("OS_ConfigServiceLib_domainEnumeratorGetElement() failed, err %d",
+                                err);
+                return OS_ERROR_GENERIC;
+            }
+
+            if (OS_SUCCESS == OS_ConfigServiceLib_compareDomainName(
+                    &domain.name,
+                    domainName))
+            {
+                return OS_SUCCESS;
+            }
+        }
+
         return OS_ERROR_GENERIC;
     }
-}
-
-//------------------------------------------------------------------------------
-void
-OS_ConfigServiceLib_parameterGetName(
-    OS_ConfigServiceLibTypes_Parameter_t const* parameter,
-    OS_ConfigServiceLibTypes_ParameterName_t* parameterName)
-{
-    *parameterName = parameter->parameterName;
-}
 
-//------------------------------------------------------------------------------
-void
-OS_ConfigServiceLib_parameterGetType(
-    OS_ConfigServiceLibTypes_Parameter_t const* parameter,
-    OS_ConfigServiceLibTypes_ParameterType_t* parameterType)
-{
-    *parameterType = parameter->parameterType;
-}
-
-//------------------------------------------------------------------------------
-size_t
-OS_ConfigServiceLib_parameterGetSize(
-    OS_ConfigServiceLibTypes_Parameter_t const* parameter)
-{
-    switch (parameter->parameterType)
+    for (;;)
     {
-    case OS_CONFIG_LIB_PARAMETER_TYPE_INTEGER32:
-        return sizeof(uint32_t);
-        break;
-
-    case OS_CONFIG_LIB_PARAMETER_TYPE_INTEGER64:
-        return sizeof(uint64_t);
-        break;
-
-    case OS_CONFIG_LIB_PARAMETER_TYPE_STRING:
-        return parameter->parameterValue.valueString.size;
-        break;
+        OS_ConfigServiceLibTypes_Domain_t domain;
+        err = OS_ConfigServiceLib_domainEnumeratorGetElement(
+                  instance,
+                  enumerator,
+                  &domain);
+        if (0 != err)
+        {
+            Debug_LOG_ERROR("OS_ConfigServiceLib_domainEnumeratorGetElement() failed, err %d",
+                            err);
+            return OS_ERROR_GENERIC;
+        }
 
-    case OS_CONFIG_LIB_PARAMETER_TYPE_BLOB:
-        return parameter->parameterValue.valueBlob.size;
-        break;
+        OS_ConfigServiceLibTypes_DomainName_t domainNameTmp;
+        OS_ConfigServiceLib_domainGetName(&domain, &domainNameTmp);
+        if (OS_SUCCESS == OS_ConfigServiceLib_compareDomainName(
+                &domainNameTmp,
+                domainName))
+        {
+            // enumerator holds the right domain
+            return OS_SUCCESS;
+        }
 
-    default:
-        return 0;
-        break;
-    }
+        err = OS_ConfigServiceLib_domainEnumeratorIncrement(instance, enumerator);
+        if (0 != err)
+        {
+            Debug_LOG_ERROR("OS_ConfigServiceLib_domainEnumeratorIncrement() failed, err %d",
+                            err);
+            return OS_ERROR_GENERIC;
+        }
+    } // end for(;;)
 }
 
 //------------------------------------------------------------------------------
 OS_Error_t
-OS_ConfigServiceLib_parameterGetValue(
+OS_ConfigServiceLib_parameterGetValueFromDomainName(
     OS_ConfigServiceLib_t* instance,
-    OS_ConfigServiceLibTypes_Parameter_t const* parameter,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_DomainName_t const* domainName,
+    OS_ConfigServiceLibTypes_ParameterName_t const* parameterName,
+    OS_ConfigServiceLibTypes_ParameterType_t parameterType,
     void* buffer,
     size_t bufferSize,
     size_t* bytesCopied)
@@ -836,68 +3716,56 @@ OS_ConfigServiceLib_parameterGetValue(
         return OS_ERROR_INVALID_STATE;
     }
 
-    size_t parameterSize = OS_ConfigServiceLib_parameterGetSize(parameter);
+    OS_Error_t err;
 
-    if (parameterSize <= bufferSize)
+    OS_ConfigServiceLibTypes_DomainEnumerator_t domain_enumerator = {0};
+    err = find_domain(instance, &domain_enumerator, domainName);
+    if (OS_SUCCESS != err)
     {
-        switch (parameter->parameterType)
-        {
-        case OS_CONFIG_LIB_PARAMETER_TYPE_INTEGER32:
-        case OS_CONFIG_LIB_PARAMETER_TYPE_INTEGER64:
-            memcpy(buffer, &parameter->parameterValue, parameterSize);
-            *bytesCopied = parameterSize;
-            break;
-
-        case OS_CONFIG_LIB_PARAMETER_TYPE_STRING:
-        {
-            OS_Error_t err = OS_ConfigServiceLib_fetchVariableLengthString(
-                                 &instance->stringBackend,
-                                 parameter->parameterValue.valueString.index,
-                                 parameterSize,
-                                 buffer,
-                                 bufferSize);
-            *bytesCopied = (err == OS_SUCCESS) ? parameterSize : 0;
-        }
-        break;
-
-        case OS_CONFIG_LIB_PARAMETER_TYPE_BLOB:
-        {
-            OS_Error_t err = OS_ConfigServiceLib_fetchVariableLengthBlob(
-                                 &instance->blobBackend,
-                                 parameterSize,
-                                 parameter->parameterValue.valueBlob.index,
-                                 parameter->parameterValue.valueBlob.numberOfBlocks,
-                                 buffer,
-                                 bufferSize);
-            *bytesCopied = (err == OS_SUCCESS) ? parameterSize : 0;
-        }
-        break;
+        Debug_LOG_ERROR("find_domain() failed, err %d", err);
+        return OS_ERROR_CONFIG_DOMAIN_NOT_FOUND;
+    }
 
-        default:
-            *bytesCopied = 0;
-            break;
-        }
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t parameter_enumerator = {0};
+    OS_ConfigServiceLibTypes_Parameter_t parameter = {0};
+    err = find_parameter(instance, appId, &domain_enumerator, parameterName,
+                         &parameter_enumerator, &parameter);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_ERROR("find_parameter() failed, err %d", err);
+        return OS_ERROR_CONFIG_PARAMETER_NOT_FOUND;
     }
-    else
+
+    if (parameterType != parameter.parameterType)
     {
-        *bytesCopied = 0;
+        Debug_LOG_ERROR("parameter tpye mismatch, requested %d found %d",
+                        parameterType, parameter.parameterType);
+        return OS_ERROR_CONFIG_TYPE_MISMATCH;
     }
 
-    if (bytesCopied <= 0)
+    err = OS_ConfigServiceLib_fetchValue(
+              instance,
+              &parameter,
+              buffer,
+              bufferSize,
+              bytesCopied);
+    if (OS_SUCCESS != err)
     {
-        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        Debug_LOG_ERROR("OS_ConfigServiceLib_fetchValue() failed, err %d", err);
+        return err;
     }
 
-    return (bytesCopied > 0) ? OS_SUCCESS : OS_ERROR_GENERIC;
+    return OS_SUCCESS;
 }
 
 //------------------------------------------------------------------------------
-// Get the parameter value - specific format.
 OS_Error_t
-OS_ConfigServiceLib_parameterGetValueAsU32(
+OS_ConfigServiceLib_parameterResolve(
     OS_ConfigServiceLib_t* instance,
-    OS_ConfigServiceLibTypes_Parameter_t const* parameter,
-    uint32_t* value)
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_DomainName_t const* domainName,
+    OS_ConfigServiceLibTypes_ParameterName_t const* parameterName,
+    OS_ConfigServiceLibTypes_ParameterId_t* parameterId)
 {
     if (!instance->isInitialized)
     {
@@ -905,89 +3773,83 @@ OS_ConfigServiceLib_parameterGetValueAsU32(
         return OS_ERROR_INVALID_STATE;
     }
 
-    *value = parameter->parameterValue.valueInteger32;
+    OS_Error_t err;
 
-    return OS_SUCCESS;
-}
+    OS_ConfigServiceLibTypes_DomainEnumerator_t domain_enumerator = {0};
+    err = find_domain(instance, &domain_enumerator, domainName);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_ERROR("find_domain() failed, err %d", err);
+        return OS_ERROR_CONFIG_DOMAIN_NOT_FOUND;
+    }
 
-//------------------------------------------------------------------------------
-// Get the parameter value - specific format.
-OS_Error_t
-OS_ConfigServiceLib_parameterGetValueAsU64(
-    OS_ConfigServiceLib_t* instance,
-    OS_ConfigServiceLibTypes_Parameter_t const* parameter,
-    uint64_t* value)
-{
-    if (!instance->isInitialized)
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t parameter_enumerator = {0};
+    OS_ConfigServiceLibTypes_Parameter_t parameter = {0};
+    err = find_parameter(instance, appId, &domain_enumerator, parameterName,
+                         &parameter_enumerator, &parameter);
+    if (OS_SUCCESS != err)
     {
-        LOG_NOT_INITIALIZED(__func__);
-        return OS_ERROR_INVALID_STATE;
+        Debug_LOG_ERROR("find_parameter() failed, err %d", err);
+        return OS_ERROR_CONFIG_PARAMETER_NOT_FOUND;
     }
 
-    *value = parameter->parameterValue.valueInteger64;
+    *parameterId = parameter_enumerator.index;
 
     return OS_SUCCESS;
 }
 
 //------------------------------------------------------------------------------
-// Get the parameter value - specific format.
+// Fetches the parameter record of the given ID. As IDs can be made up by the
+// caller, the parameter has to pass the same visibility check as it would
+// have to when it was resolved.
+static
 OS_Error_t
-OS_ConfigServiceLib_parameterGetValueAsString(
+OS_ConfigServiceLib_parameterGetById(
     OS_ConfigServiceLib_t* instance,
-    OS_ConfigServiceLibTypes_Parameter_t const* parameter,
-    char* buffer,
-    size_t bufferSize)
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_ParameterId_t parameterId,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t* enumerator,
+    OS_ConfigServiceLibTypes_Parameter_t* parameter)
 {
-    if (!instance->isInitialized)
+    if (parameterId >= OS_ConfigServiceBackend_getNumberOfRecords(
+            &instance->parameterBackend))
     {
-        LOG_NOT_INITIALIZED(__func__);
-        return OS_ERROR_INVALID_STATE;
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_CONFIG_PARAMETER_NOT_FOUND;
     }
 
-    size_t bytesCopied;
-
-    return OS_ConfigServiceLib_parameterGetValue(
-               instance,
-               parameter,
-               buffer,
-               bufferSize,
-               &bytesCopied);
-}
+    OS_Error_t err = OS_ConfigServiceLib_readParameter(
+                         instance,
+                         parameterId,
+                         parameter);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_ERROR("OS_ConfigServiceLib_readParameter() failed, error %d", err);
+        return OS_ERROR_GENERIC;
+    }
 
-//------------------------------------------------------------------------------
-// Get the parameter value - specific format.
-OS_Error_t
-OS_ConfigServiceLib_parameterGetValueAsBlob(
-    OS_ConfigServiceLib_t* instance,
-    OS_ConfigServiceLibTypes_Parameter_t const* parameter,
-    void* buffer,
-    size_t bufferSize)
-{
-    if (!instance->isInitialized)
+    if (!OS_ConfigServiceLib_ParameterIsVisibleFor(parameter, appId))
     {
-        LOG_NOT_INITIALIZED(__func__);
-        return OS_ERROR_INVALID_STATE;
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_CONFIG_PARAMETER_NOT_FOUND;
     }
 
-    size_t bytesCopied;
+    enumerator->index = parameterId;
+    enumerator->domainEnumerator = parameter->domain;
 
-    return OS_ConfigServiceLib_parameterGetValue(
-               instance,
-               parameter,
-               buffer,
-               bufferSize,
-               &bytesCopied);
+    return OS_SUCCESS;
 }
 
 //------------------------------------------------------------------------------
-// Set the parameter value - raw format.
 OS_Error_t
-OS_ConfigServiceLib_parameterSetValue(
+OS_ConfigServiceLib_parameterGetValueById(
     OS_ConfigServiceLib_t* instance,
-    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_ParameterId_t parameterId,
     OS_ConfigServiceLibTypes_ParameterType_t parameterType,
-    void const* buffer,
-    size_t bufferSize)
+    void* buffer,
+    size_t bufferSize,
+    size_t* bytesCopied)
 {
     if (!instance->isInitialized)
     {
@@ -995,151 +3857,51 @@ OS_ConfigServiceLib_parameterSetValue(
         return OS_ERROR_INVALID_STATE;
     }
 
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t enumerator;
     OS_ConfigServiceLibTypes_Parameter_t parameter;
 
-    // Fetch the parameter pointed to by the enumerator.
-    // Check the parameter type to be written is correct.
-    // All integral types: handling is straight forward.
-    // String and blob: check the given size is ok and
-    // which may be smaller than the maximum record size.
-
-    OS_Error_t err = OS_ConfigServiceLib_parameterEnumeratorGetElement(
+    OS_Error_t err = OS_ConfigServiceLib_parameterGetById(
                          instance,
-                         enumerator,
+                         appId,
+                         parameterId,
+                         &enumerator,
                          &parameter);
     if (OS_SUCCESS != err)
     {
         Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
-        return OS_ERROR_GENERIC;
-    }
-
-    err = OS_ConfigServiceLib_ParameterIsWriteableForMe(&parameter) ? 0 : -1;
-    if (OS_SUCCESS != err)
-    {
-        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
-        return OS_ERROR_GENERIC;
+        return err;
     }
 
     if (parameterType != parameter.parameterType)
     {
-        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
-        return OS_ERROR_GENERIC;
-    }
-
-    size_t parameterSize = OS_ConfigServiceLib_parameterGetSize(&parameter);
-
-    switch (parameter.parameterType)
-    {
-    case OS_CONFIG_LIB_PARAMETER_TYPE_INTEGER32:
-    case OS_CONFIG_LIB_PARAMETER_TYPE_INTEGER64:
-        if (parameterSize == bufferSize)
-        {
-            memcpy(&parameter.parameterValue, buffer, parameterSize);
-            err = OS_SUCCESS;
-        }
-        else
-        {
-            Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
-            err = OS_ERROR_GENERIC;
-        }
-        break;
-
-    case OS_CONFIG_LIB_PARAMETER_TYPE_STRING:
-        parameter.parameterValue.valueString.size = bufferSize;
-
-        err = OS_ConfigServiceLib_writeVariableLengthString(
-                  &instance->stringBackend,
-                  parameter.parameterValue.valueString.index,
-                  buffer,
-                  bufferSize);
-        break;
-
-    case OS_CONFIG_LIB_PARAMETER_TYPE_BLOB:
-        parameter.parameterValue.valueBlob.size = bufferSize;
-
-        err = OS_ConfigServiceLib_writeVariableLengthBlob(
-                  &instance->blobBackend,
-                  parameter.parameterValue.valueBlob.index,
-                  parameter.parameterValue.valueBlob.numberOfBlocks,
-                  buffer,
-                  bufferSize);
-        break;
-
-    default:
-        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
-        err = OS_ERROR_GENERIC;
-        break;
-    }
-
-    if (OS_SUCCESS == err)
-    {
-        err = OS_ConfigServiceBackend_writeRecord(
-                  &instance->parameterBackend,
-                  enumerator->index,
-                  &parameter,
-                  sizeof(parameter));
-    }
-    else
-    {
-        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
-        err = OS_ERROR_GENERIC;
-    }
-
-    return err;
-}
-
-//------------------------------------------------------------------------------
-// Set the parameter value - specific format.
-OS_Error_t
-OS_ConfigServiceLib_parameterSetValueAsU32(
-    OS_ConfigServiceLib_t* instance,
-    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
-    uint32_t value)
-{
-    if (!instance->isInitialized)
-    {
-        LOG_NOT_INITIALIZED(__func__);
-        return OS_ERROR_INVALID_STATE;
+        Debug_LOG_ERROR("parameter tpye mismatch, requested %d found %d",
+                        parameterType, parameter.parameterType);
+        return OS_ERROR_CONFIG_TYPE_MISMATCH;
     }
 
-    return OS_ConfigServiceLib_parameterSetValue(
-               instance,
-               enumerator,
-               OS_CONFIG_LIB_PARAMETER_TYPE_INTEGER32,
-               &value,
-               sizeof(uint32_t));
-}
-
-//------------------------------------------------------------------------------
-// Set the parameter value - specific format.
-OS_Error_t
-OS_ConfigServiceLib_parameterSetValueAsU64(
-    OS_ConfigServiceLib_t* instance,
-    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
-    uint64_t value)
-{
-    if (!instance->isInitialized)
+    err = OS_ConfigServiceLib_fetchValue(
+              instance,
+              &parameter,
+              buffer,
+              bufferSize,
+              bytesCopied);
+    if (OS_SUCCESS != err)
     {
-        LOG_NOT_INITIALIZED(__func__);
-        return OS_ERROR_INVALID_STATE;
+        Debug_LOG_ERROR("OS_ConfigServiceLib_fetchValue() failed, err %d", err);
+        return err;
     }
-
-    return OS_ConfigServiceLib_parameterSetValue(
-               instance,
-               enumerator,
-               OS_CONFIG_LIB_PARAMETER_TYPE_INTEGER64,
-               &value,
-               sizeof(uint64_t));
+
+    return OS_SUCCESS;
 }
 
 //------------------------------------------------------------------------------
-// Set the parameter value - specific format.
 OS_Error_t
-OS_ConfigServiceLib_parameterSetValueAsString(
+OS_ConfigServiceLib_parameterSetValueById(
     OS_ConfigServiceLib_t* instance,
-    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_ParameterId_t parameterId,
     OS_ConfigServiceLibTypes_ParameterType_t parameterType,
-    char const* buffer,
+    void const* buffer,
     size_t bufferSize)
 {
     if (!instance->isInitialized)
@@ -1148,23 +3910,49 @@ OS_ConfigServiceLib_parameterSetValueAsString(
         return OS_ERROR_INVALID_STATE;
     }
 
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t enumerator;
+    OS_ConfigServiceLibTypes_Parameter_t parameter;
+
+    OS_Error_t err = OS_ConfigServiceLib_parameterGetById(
+                         instance,
+                         appId,
+                         parameterId,
+                         &enumerator,
+                         &parameter);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return err;
+    }
+
+    if (parameterType != parameter.parameterType)
+    {
+        Debug_LOG_ERROR("parameter tpye mismatch, requested %d found %d",
+                        parameterType, parameter.parameterType);
+        return OS_ERROR_CONFIG_TYPE_MISMATCH;
+    }
+
     return OS_ConfigServiceLib_parameterSetValue(
                instance,
-               enumerator,
-               OS_CONFIG_LIB_PARAMETER_TYPE_STRING,
+               appId,
+               &enumerator,
+               parameterType,
                buffer,
                bufferSize);
 }
 
 //------------------------------------------------------------------------------
-// Set the parameter value - specific format.
+// The values are placed at 8 byte aligned offsets, so they can be accessed in
+// place no matter which type they have.
 OS_Error_t
-OS_ConfigServiceLib_parameterSetValueAsBlob(
+OS_ConfigServiceLib_parameterGetValuesBatch(
     OS_ConfigServiceLib_t* instance,
-    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
-    OS_ConfigServiceLibTypes_ParameterType_t parameterType,
-    void const* buffer,
-    size_t bufferSize)
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_BatchEntry_t* entries,
+    size_t numberOfEntries,
+    void* buffer,
+    size_t bufferSize,
+    size_t* bytesCopied)
 {
     if (!instance->isInitialized)
     {
@@ -1172,131 +3960,268 @@ OS_ConfigServiceLib_parameterSetValueAsBlob(
         return OS_ERROR_INVALID_STATE;
     }
 
-    return OS_ConfigServiceLib_parameterSetValue(
-               instance,
-               enumerator,
-               OS_CONFIG_LIB_PARAMETER_TYPE_BLOB,
-               buffer,
-               bufferSize);
+    OS_Error_t firstError = OS_SUCCESS;
+    size_t used = 0;
+
+    *bytesCopied = 0;
+
+    for (size_t k = 0; k < numberOfEntries; ++k)
+    {
+        OS_ConfigServiceLibTypes_BatchEntry_t* entry = &entries[k];
+        OS_Error_t err = OS_SUCCESS;
+        size_t offset = (used + 7) & ~(size_t)7;
+        size_t size = 0;
+
+        entry->offset = 0;
+        entry->size = 0;
+
+        if (OS_CONFIG_LIB_PARAMETER_ID_NONE == entry->parameterId)
+        {
+            err = OS_ConfigServiceLib_parameterResolve(
+                      instance,
+                      appId,
+                      &entry->domainName,
+                      &entry->parameterName,
+                      &entry->parameterId);
+        }
+
+        if ((OS_SUCCESS == err) && (offset > bufferSize))
+        {
+            Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+            err = OS_ERROR_BUFFER_TOO_SMALL;
+        }
+
+        if (OS_SUCCESS == err)
+        {
+            err = OS_ConfigServiceLib_parameterGetValueById(
+                      instance,
+                      appId,
+                      entry->parameterId,
+                      entry->parameterType,
+                      (char*)buffer + offset,
+                      bufferSize - offset,
+                      &size);
+        }
+
+        entry->result = err;
+
+        if (OS_SUCCESS == err)
+        {
+            entry->offset = offset;
+            entry->size = size;
+            used = offset + size;
+        }
+        else if (OS_SUCCESS == firstError)
+        {
+            Debug_LOG_ERROR("batch entry %zu failed, err %d", k, err);
+            firstError = err;
+        }
+    }
+
+    *bytesCopied = used;
+
+    return firstError;
 }
 
 //------------------------------------------------------------------------------
+// Reserves the records the value of the given parameter moves to, if it moves.
+// A value that does not move according to the records as they are now may
+// still move once earlier entries of the batch are written, if they write the
+// same parameter or share values, so such a value reserves records as well.
 static
 OS_Error_t
-find_parameter(
+OS_ConfigServiceLib_reserveExtent(
     OS_ConfigServiceLib_t* instance,
-    OS_ConfigServiceLibTypes_DomainEnumerator_t* domainEnumerator,
-    OS_ConfigServiceLibTypes_ParameterName_t const* parameterName,
-    OS_ConfigServiceLibTypes_Parameter_t* parameter)
+    OS_ConfigServiceLibTypes_Parameter_t const* parameter,
+    size_t bufferSize,
+    bool mayMove,
+    OS_ConfigServiceLib_Reservation_t* reservation)
 {
-    OS_Error_t err;
-    OS_ConfigServiceLibTypes_ParameterEnumerator_t paramEnumerator = {0};
+    reservation->map = NULL;
+    reservation->numberOfRecords = 0;
 
-    err = OS_ConfigServiceLib_parameterEnumeratorInit(
-              instance,
-              domainEnumerator,
-              &paramEnumerator);
-    if (0 != err)
+#if defined(OS_CONFIG_SERVICE_DEDUP)
+    mayMove = true;
+#endif
+
+    switch (parameter->parameterType)
     {
-        Debug_LOG_ERROR("OS_ConfigServiceLib_parameterEnumeratorInit() failed, err %d",
-                        err);
-        return OS_ERROR_GENERIC;
+    case OS_CONFIG_LIB_PARAMETER_TYPE_STRING:
+    {
+        uint32_t oldRecords = OS_ConfigServiceLib_getNumberOfRecords(
+                                  &instance->stringBackend,
+                                  parameter->parameterValue.valueString.size);
+
+        reservation->numberOfRecords = OS_ConfigServiceLib_getNumberOfRecords(
+                                           &instance->stringBackend,
+                                           bufferSize);
+
+        if (mayMove ||
+            (reservation->numberOfRecords > oldRecords) ||
+            OS_ConfigServiceExtentMap_isShared(
+                &instance->stringExtents,
+                parameter->parameterValue.valueString.index,
+                oldRecords))
+        {
+            reservation->map = &instance->stringExtents;
+        }
     }
+    break;
 
-    for (;;)
+    case OS_CONFIG_LIB_PARAMETER_TYPE_BLOB:
     {
-        err = OS_ConfigServiceLib_parameterEnumeratorGetElement(
-                  instance,
-                  &paramEnumerator,
-                  parameter);
-        if (0 != err)
+        OS_Error_t err = OS_ConfigServiceLib_getNumberOfBlobBlocks(
+                             instance,
+                             bufferSize,
+                             &reservation->numberOfRecords);
+        if (OS_SUCCESS != err)
         {
-            Debug_LOG_ERROR("OS_ConfigServiceLib_parameterEnumeratorGetElement() failed, err %d",
-                            err);
-            return OS_ERROR_GENERIC;
+            Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+            return err;
         }
 
-        OS_ConfigServiceLibTypes_ParameterName_t parameterNameTmp;
-        OS_ConfigServiceLib_parameterGetName(parameter, &parameterNameTmp);
-        if (OS_SUCCESS == OS_ConfigServiceLib_compareParameterName(
-                &parameterNameTmp,
-                parameterName))
+        if (mayMove ||
+            OS_ConfigServiceLib_isBlobMoving(
+                instance,
+                parameter,
+                reservation->numberOfRecords))
         {
-            // enumerator holds the right paramter
-            return OS_SUCCESS;
+            reservation->map = &instance->blobExtents;
         }
+    }
+    break;
 
-        err = OS_ConfigServiceLib_parameterEnumeratorIncrement(
-                  instance,
-                  &paramEnumerator);
-        if (0 != err)
+    default:
+        break;
+    }
+
+    if ((NULL == reservation->map) || (0 == reservation->numberOfRecords))
+    {
+        reservation->map = NULL;
+        return OS_SUCCESS;
+    }
+
+    OS_Error_t err = OS_ConfigServiceExtentMap_allocate(
+                         reservation->map,
+                         reservation->numberOfRecords,
+                         &reservation->index);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        reservation->map = NULL;
+        return OS_ERROR_INSUFFICIENT_SPACE;
+    }
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+static
+void
+OS_ConfigServiceLib_releaseReservations(
+    OS_ConfigServiceLib_Reservation_t const* reservations,
+    size_t numberOfReservations)
+{
+    for (size_t k = 0; k < numberOfReservations; ++k)
+    {
+        OS_ConfigServiceExtentMap_release(
+            reservations[k].map,
+            reservations[k].index,
+            reservations[k].numberOfRecords);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Returns true if an earlier entry of the batch sets the same parameter.
+static
+bool
+OS_ConfigServiceLib_isSetEarlier(
+    OS_ConfigServiceLibTypes_BatchEntry_t const* entries,
+    size_t entry)
+{
+    for (size_t k = 0; k < entry; ++k)
+    {
+        if (entries[k].parameterId == entries[entry].parameterId)
         {
-            Debug_LOG_ERROR("OS_ConfigServiceLib_parameterEnumeratorIncrement() failed, err %d",
-                            err);
-            return OS_ERROR_GENERIC;
+            return true;
         }
-    } // end for(;;)
+    }
+
+    return false;
 }
 
 //------------------------------------------------------------------------------
+// Checks a batch entry against the parameter as it is stored now. The entry
+// is a copy, so it cannot change between the check and the write.
 static
 OS_Error_t
-find_domain(
+OS_ConfigServiceLib_checkBatchEntry(
     OS_ConfigServiceLib_t* instance,
-    OS_ConfigServiceLibTypes_DomainEnumerator_t* enumerator,
-    OS_ConfigServiceLibTypes_DomainName_t const* domainName)
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_BatchEntry_t* entry,
+    size_t bufferSize,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t* enumerator,
+    OS_ConfigServiceLibTypes_Parameter_t* parameter)
 {
-    OS_Error_t err = OS_ConfigServiceLib_domainEnumeratorInit(instance,
-                                                              enumerator);
-    if (OS_SUCCESS != err)
-    {
-        return err;
-    }
+    OS_Error_t err = OS_SUCCESS;
 
-    for (;;)
+    if (OS_CONFIG_LIB_PARAMETER_ID_NONE == entry->parameterId)
     {
-        OS_ConfigServiceLibTypes_Domain_t domain;
-        err = OS_ConfigServiceLib_domainEnumeratorGetElement(
+        err = OS_ConfigServiceLib_parameterResolve(
                   instance,
-                  enumerator,
-                  &domain);
-        if (0 != err)
+                  appId,
+                  &entry->domainName,
+                  &entry->parameterName,
+                  &entry->parameterId);
+        if (OS_SUCCESS != err)
         {
-            Debug_LOG_ERROR("OS_ConfigServiceLib_domainEnumeratorGetElement() failed, err %d",
-                            err);
-            return OS_ERROR_GENERIC;
+            Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+            return err;
         }
+    }
 
-        OS_ConfigServiceLibTypes_DomainName_t domainNameTmp;
-        OS_ConfigServiceLib_domainGetName(&domain, &domainNameTmp);
-        if (OS_SUCCESS == OS_ConfigServiceLib_compareDomainName(
-                &domainNameTmp,
-                domainName))
-        {
-            // enumerator holds the right domain
-            return OS_SUCCESS;
-        }
+    if ((entry->offset > bufferSize) ||
+        (entry->size > bufferSize - entry->offset))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
 
-        err = OS_ConfigServiceLib_domainEnumeratorIncrement(instance, enumerator);
-        if (0 != err)
-        {
-            Debug_LOG_ERROR("OS_ConfigServiceLib_domainEnumeratorIncrement() failed, err %d",
-                            err);
-            return OS_ERROR_GENERIC;
-        }
-    } // end for(;;)
+    err = OS_ConfigServiceLib_parameterGetById(
+              instance,
+              appId,
+              entry->parameterId,
+              enumerator,
+              parameter);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return err;
+    }
+
+    return OS_ConfigServiceLib_parameterCheckValue(
+               instance,
+               appId,
+               parameter,
+               entry->parameterType,
+               entry->size);
 }
 
 //------------------------------------------------------------------------------
+// All entries are checked before the first one is written, so a rejected
+// entry leaves the configuration untouched. The records values move to are
+// reserved while checking, so writing them cannot run out of space half way.
+// Each reservation is released right before its entry is written, the write
+// then finds at least these records free. The backends are committed once
+// after all values are written.
 OS_Error_t
-OS_ConfigServiceLib_parameterGetValueFromDomainName(
+OS_ConfigServiceLib_parameterSetValuesBatch(
     OS_ConfigServiceLib_t* instance,
-    OS_ConfigServiceLibTypes_DomainName_t const* domainName,
-    OS_ConfigServiceLibTypes_ParameterName_t const* parameterName,
-    OS_ConfigServiceLibTypes_ParameterType_t parameterType,
-    void* buffer,
-    size_t bufferSize,
-    size_t* bytesCopied)
+    unsigned int appId,
+    OS_ConfigServiceLibTypes_BatchEntry_t* entries,
+    size_t numberOfEntries,
+    void const* buffer,
+    size_t bufferSize)
 {
     if (!instance->isInitialized)
     {
@@ -1304,44 +4229,129 @@ OS_ConfigServiceLib_parameterGetValueFromDomainName(
         return OS_ERROR_INVALID_STATE;
     }
 
-    OS_Error_t err;
+    OS_ConfigServiceLib_Reservation_t reservations[OS_CONFIG_LIB_BATCH_MAX_RESERVATIONS];
+    size_t numberOfReservations = 0;
+    OS_Error_t firstError = OS_SUCCESS;
 
-    OS_ConfigServiceLibTypes_DomainEnumerator_t domain_enumerator = {0};
-    err = find_domain(instance, &domain_enumerator, domainName);
-    if (OS_SUCCESS != err)
+    for (size_t k = 0; k < numberOfEntries; ++k)
     {
-        Debug_LOG_ERROR("find_domain() failed, err %d", err);
-        return OS_ERROR_CONFIG_DOMAIN_NOT_FOUND;
+        // The entries may be changed by the caller meanwhile, so each one is
+        // read once.
+        OS_ConfigServiceLibTypes_BatchEntry_t entry = entries[k];
+        OS_ConfigServiceLibTypes_ParameterEnumerator_t enumerator;
+        OS_ConfigServiceLibTypes_Parameter_t parameter;
+        OS_ConfigServiceLib_Reservation_t reservation;
+
+        OS_Error_t err = OS_ConfigServiceLib_checkBatchEntry(
+                             instance,
+                             appId,
+                             &entry,
+                             bufferSize,
+                             &enumerator,
+                             &parameter);
+
+        // Once an entry is rejected, nothing is written anyway.
+        if ((OS_SUCCESS == err) && (OS_SUCCESS == firstError))
+        {
+            err = OS_ConfigServiceLib_reserveExtent(
+                      instance,
+                      &parameter,
+                      entry.size,
+                      OS_ConfigServiceLib_isSetEarlier(entries, k),
+                      &reservation);
+        }
+
+        if ((OS_SUCCESS == err) && (OS_SUCCESS == firstError) &&
+            (NULL != reservation.map))
+        {
+            if (numberOfReservations < OS_CONFIG_LIB_BATCH_MAX_RESERVATIONS)
+            {
+                reservation.entry = k;
+                reservations[numberOfReservations++] = reservation;
+            }
+            else
+            {
+                Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+                OS_ConfigServiceLib_releaseReservations(&reservation, 1);
+                err = OS_ERROR_INSUFFICIENT_SPACE;
+            }
+        }
+
+        entries[k].parameterId = entry.parameterId;
+        entries[k].result = err;
+
+        if ((OS_SUCCESS != err) && (OS_SUCCESS == firstError))
+        {
+            Debug_LOG_ERROR("batch entry %zu rejected, err %d", k, err);
+            firstError = err;
+        }
     }
 
-    OS_ConfigServiceLibTypes_Parameter_t parameter = {0};
-    err = find_parameter(instance, &domain_enumerator, parameterName, &parameter);
-    if (OS_SUCCESS != err)
+    if (OS_SUCCESS != firstError)
     {
-        Debug_LOG_ERROR("find_parameter() failed, err %d", err);
-        return OS_ERROR_CONFIG_PARAMETER_NOT_FOUND;
+        OS_ConfigServiceLib_releaseReservations(
+            reservations,
+            numberOfReservations);
+        return firstError;
     }
 
-    if (parameterType != parameter.parameterType)
+    size_t nextReservation = 0;
+
+    for (size_t k = 0; k < numberOfEntries; ++k)
     {
-        Debug_LOG_ERROR("parameter tpye mismatch, requested %d found %d",
-                        parameterType, parameter.parameterType);
-        return OS_ERROR_CONFIG_TYPE_MISMATCH;
+        OS_ConfigServiceLibTypes_BatchEntry_t entry = entries[k];
+        OS_ConfigServiceLibTypes_ParameterEnumerator_t enumerator;
+        OS_ConfigServiceLibTypes_Parameter_t parameter;
+
+        if ((nextReservation < numberOfReservations) &&
+            (reservations[nextReservation].entry == k))
+        {
+            OS_ConfigServiceLib_releaseReservations(
+                &reservations[nextReservation++],
+                1);
+        }
+
+        // Check the entry again with the record as it is now, an earlier entry
+        // may have changed the record and the caller the entry.
+        OS_Error_t err = OS_ConfigServiceLib_checkBatchEntry(
+                             instance,
+                             appId,
+                             &entry,
+                             bufferSize,
+                             &enumerator,
+                             &parameter);
+        if (OS_SUCCESS == err)
+        {
+            err = OS_ConfigServiceLib_parameterWriteValue(
+                      instance,
+                      enumerator.index,
+                      &parameter,
+                      (char const*)buffer + entry.offset,
+                      entry.size);
+        }
+
+        if (OS_SUCCESS != err)
+        {
+            Debug_LOG_ERROR("writing batch entry %zu failed, err %d", k, err);
+            entries[k].result = err;
+            OS_ConfigServiceLib_releaseReservations(
+                &reservations[nextReservation],
+                numberOfReservations - nextReservation);
+            return err;
+        }
     }
 
-    err = OS_ConfigServiceLib_parameterGetValue(
-              instance,
-              &parameter,
-              buffer,
-              bufferSize,
-              bytesCopied);
-    if (err < 0)
+    // Payloads first, so no committed parameter record refers to a payload
+    // that is not committed.
+    OS_Error_t err = OS_ConfigServiceLib_commitBackend(&instance->stringBackend);
+    if (OS_SUCCESS == err)
     {
-        Debug_LOG_ERROR("OS_ConfigServiceLib_parameterGetValue() failed, err %d", err);
-        // ToDo: OS_ConfigServiceLib_parameterGetValue() should return error codes
-        //       about the actual problem, so we can return them
-        return OS_ERROR_GENERIC;
+        err = OS_ConfigServiceLib_commitBackend(&instance->blobBackend);
+    }
+    if (OS_SUCCESS == err)
+    {
+        err = OS_ConfigServiceLib_commitBackend(&instance->parameterBackend);
     }
 
-    return OS_SUCCESS;
+    return err;
 }
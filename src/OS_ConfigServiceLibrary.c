@@ -134,6 +134,7 @@ OS_ConfigServiceLibrary_parameterEnumeratorInit(
                                           OS_ConfigServiceHandle_getLocalInstance(handle);
         return OS_ConfigServiceLib_parameterEnumeratorInit(
                    instance,
+                   OS_ConfigServiceHandle_getAppId(handle),
                    domainEnumerator,
                    enumerator);
     }
@@ -174,7 +175,10 @@ OS_ConfigServiceLibrary_parameterEnumeratorReset(
     {
         OS_ConfigServiceLib_t* instance = (OS_ConfigServiceLib_t*)
                                           OS_ConfigServiceHandle_getLocalInstance(handle);
-        return OS_ConfigServiceLib_parameterEnumeratorReset(instance, enumerator);
+        return OS_ConfigServiceLib_parameterEnumeratorReset(
+                   instance,
+                   OS_ConfigServiceHandle_getAppId(handle),
+                   enumerator);
     }
     else
     {
@@ -193,7 +197,10 @@ OS_ConfigServiceLibrary_parameterEnumeratorIncrement(
     {
         OS_ConfigServiceLib_t* instance = (OS_ConfigServiceLib_t*)
                                           OS_ConfigServiceHandle_getLocalInstance(handle);
-        return OS_ConfigServiceLib_parameterEnumeratorIncrement(instance, enumerator);
+        return OS_ConfigServiceLib_parameterEnumeratorIncrement(
+                   instance,
+                   OS_ConfigServiceHandle_getAppId(handle),
+                   enumerator);
     }
     else
     {
@@ -215,6 +222,7 @@ OS_ConfigServiceLibrary_parameterEnumeratorGetElement(
                                           OS_ConfigServiceHandle_getLocalInstance(handle);
         return OS_ConfigServiceLib_parameterEnumeratorGetElement(
                    instance,
+                   OS_ConfigServiceHandle_getAppId(handle),
                    enumerator,
                    parameter);
     }
@@ -248,6 +256,7 @@ OS_ConfigServiceLibrary_domainCreateParameterEnumerator(
                                           OS_ConfigServiceHandle_getLocalInstance(handle);
         return OS_ConfigServiceLib_domainCreateParameterEnumerator(
                    instance,
+                   OS_ConfigServiceHandle_getAppId(handle),
                    domain,
                    parameterName,
                    parameterEnumerator);
@@ -273,6 +282,7 @@ OS_ConfigServiceLibrary_domainGetElement(
                                           OS_ConfigServiceHandle_getLocalInstance(handle);
         return OS_ConfigServiceLib_domainGetElement(
                    instance,
+                   OS_ConfigServiceHandle_getAppId(handle),
                    domain,
                    parameterName,
                    parameter);
@@ -325,6 +335,7 @@ OS_ConfigServiceLibrary_parameterGetValue(
                                           OS_ConfigServiceHandle_getLocalInstance(handle);
         return OS_ConfigServiceLib_parameterGetValue(
                    instance,
+                   OS_ConfigServiceHandle_getAppId(handle),
                    parameter,
                    buffer,
                    bufferSize,
@@ -348,7 +359,11 @@ OS_ConfigServiceLibrary_parameterGetValueAsU32(
     {
         OS_ConfigServiceLib_t* instance = (OS_ConfigServiceLib_t*)
                                           OS_ConfigServiceHandle_getLocalInstance(handle);
-        return OS_ConfigServiceLib_parameterGetValueAsU32(instance, parameter, value);
+        return OS_ConfigServiceLib_parameterGetValueAsU32(
+                   instance,
+                   OS_ConfigServiceHandle_getAppId(handle),
+                   parameter,
+                   value);
     }
     else
     {
@@ -368,7 +383,11 @@ OS_ConfigServiceLibrary_parameterGetValueAsU64(
     {
         OS_ConfigServiceLib_t* instance = (OS_ConfigServiceLib_t*)
                                           OS_ConfigServiceHandle_getLocalInstance(handle);
-        return OS_ConfigServiceLib_parameterGetValueAsU64(instance, parameter, value);
+        return OS_ConfigServiceLib_parameterGetValueAsU64(
+                   instance,
+                   OS_ConfigServiceHandle_getAppId(handle),
+                   parameter,
+                   value);
     }
     else
     {
@@ -391,6 +410,7 @@ OS_ConfigServiceLibrary_parameterGetValueAsString(
                                           OS_ConfigServiceHandle_getLocalInstance(handle);
         return OS_ConfigServiceLib_parameterGetValueAsString(
                    instance,
+                   OS_ConfigServiceHandle_getAppId(handle),
                    parameter,
                    buffer,
                    bufferSize);
@@ -416,6 +436,7 @@ OS_ConfigServiceLibrary_parameterGetValueAsBlob(
                                           OS_ConfigServiceHandle_getLocalInstance(handle);
         return OS_ConfigServiceLib_parameterGetValueAsBlob(
                    instance,
+                   OS_ConfigServiceHandle_getAppId(handle),
                    parameter,
                    buffer,
                    bufferSize);
@@ -442,6 +463,7 @@ OS_ConfigServiceLibrary_parameterSetValue(
                                           OS_ConfigServiceHandle_getLocalInstance(handle);
         return OS_ConfigServiceLib_parameterSetValue(
                    instance,
+                   OS_ConfigServiceHandle_getAppId(handle),
                    enumerator,
                    parameterType,
                    buffer,
@@ -465,7 +487,11 @@ OS_ConfigServiceLibrary_parameterSetValueAsU32(
     {
         OS_ConfigServiceLib_t* instance = (OS_ConfigServiceLib_t*)
                                           OS_ConfigServiceHandle_getLocalInstance(handle);
-        return OS_ConfigServiceLib_parameterSetValueAsU32(instance, enumerator, value);
+        return OS_ConfigServiceLib_parameterSetValueAsU32(
+                   instance,
+                   OS_ConfigServiceHandle_getAppId(handle),
+                   enumerator,
+                   value);
     }
     else
     {
@@ -485,7 +511,11 @@ OS_ConfigServiceLibrary_parameterSetValueAsU64(
     {
         OS_ConfigServiceLib_t* instance = (OS_ConfigServiceLib_t*)
                                           OS_ConfigServiceHandle_getLocalInstance(handle);
-        return OS_ConfigServiceLib_parameterSetValueAsU64(instance, enumerator, value);
+        return OS_ConfigServiceLib_parameterSetValueAsU64(
+                   instance,
+                   OS_ConfigServiceHandle_getAppId(handle),
+                   enumerator,
+                   value);
     }
     else
     {
@@ -509,6 +539,7 @@ OS_ConfigServiceLibrary_parameterSetValueAsString(
                                           OS_ConfigServiceHandle_getLocalInstance(handle);
         return OS_ConfigServiceLib_parameterSetValueAsString(
                    instance,
+                   OS_ConfigServiceHandle_getAppId(handle),
                    enumerator,
                    parameterType,
                    buffer,
@@ -536,6 +567,7 @@ OS_ConfigServiceLibrary_parameterSetValueAsBlob(
                                           OS_ConfigServiceHandle_getLocalInstance(handle);
         return OS_ConfigServiceLib_parameterSetValueAsBlob(
                    instance,
+                   OS_ConfigServiceHandle_getAppId(handle),
                    enumerator,
                    parameterType,
                    buffer,
@@ -565,6 +597,7 @@ OS_ConfigServiceLibrary_parameterGetValueFromDomainName(
                                           OS_ConfigServiceHandle_getLocalInstance(handle);
         return OS_ConfigServiceLib_parameterGetValueFromDomainName(
                    instance,
+                   OS_ConfigServiceHandle_getAppId(handle),
                    domainName,
                    parameterName,
                    parameterType,
@@ -577,3 +610,229 @@ OS_ConfigServiceLibrary_parameterGetValueFromDomainName(
         return OS_ERROR_INVALID_PARAMETER;
     }
 }
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceLibrary_parameterResolve(
+    OS_ConfigServiceHandle_t handle,
+    OS_ConfigServiceLibTypes_DomainName_t const* domainName,
+    OS_ConfigServiceLibTypes_ParameterName_t const* parameterName,
+    OS_ConfigServiceLibTypes_ParameterId_t* parameterId)
+{
+    if (OS_CONFIG_HANDLE_KIND_LOCAL == OS_ConfigServiceHandle_getHandleKind(
+            handle))
+    {
+        OS_ConfigServiceLib_t* instance = (OS_ConfigServiceLib_t*)
+                                          OS_ConfigServiceHandle_getLocalInstance(handle);
+        return OS_ConfigServiceLib_parameterResolve(
+                   instance,
+                   OS_ConfigServiceHandle_getAppId(handle),
+                   domainName,
+                   parameterName,
+                   parameterId);
+    }
+    else
+    {
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceLibrary_parameterGetValueById(
+    OS_ConfigServiceHandle_t handle,
+    OS_ConfigServiceLibTypes_ParameterId_t parameterId,
+    OS_ConfigServiceLibTypes_ParameterType_t parameterType,
+    void* buffer,
+    size_t bufferSize,
+    size_t* bytesCopied)
+{
+    if (OS_CONFIG_HANDLE_KIND_LOCAL == OS_ConfigServiceHandle_getHandleKind(
+            handle))
+    {
+        OS_ConfigServiceLib_t* instance = (OS_ConfigServiceLib_t*)
+                                          OS_ConfigServiceHandle_getLocalInstance(handle);
+        return OS_ConfigServiceLib_parameterGetValueById(
+                   instance,
+                   OS_ConfigServiceHandle_getAppId(handle),
+                   parameterId,
+                   parameterType,
+                   buffer,
+                   bufferSize,
+                   bytesCopied);
+    }
+    else
+    {
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceLibrary_parameterSetValueById(
+    OS_ConfigServiceHandle_t handle,
+    OS_ConfigServiceLibTypes_ParameterId_t parameterId,
+    OS_ConfigServiceLibTypes_ParameterType_t parameterType,
+    void const* buffer,
+    size_t bufferSize)
+{
+    if (OS_CONFIG_HANDLE_KIND_LOCAL == OS_ConfigServiceHandle_getHandleKind(
+            handle))
+    {
+        OS_ConfigServiceLib_t* instance = (OS_ConfigServiceLib_t*)
+                                          OS_ConfigServiceHandle_getLocalInstance(handle);
+        return OS_ConfigServiceLib_parameterSetValueById(
+                   instance,
+                   OS_ConfigServiceHandle_getAppId(handle),
+                   parameterId,
+                   parameterType,
+                   buffer,
+                   bufferSize);
+    }
+    else
+    {
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceLibrary_parameterGetValuesBatch(
+    OS_ConfigServiceHandle_t handle,
+    OS_ConfigServiceLibTypes_BatchEntry_t* entries,
+    size_t numberOfEntries,
+    void* buffer,
+    size_t bufferSize,
+    size_t* bytesCopied)
+{
+    if (OS_CONFIG_HANDLE_KIND_LOCAL == OS_ConfigServiceHandle_getHandleKind(
+            handle))
+    {
+        OS_ConfigServiceLib_t* instance = (OS_ConfigServiceLib_t*)
+                                          OS_ConfigServiceHandle_getLocalInstance(handle);
+        return OS_ConfigServiceLib_parameterGetValuesBatch(
+                   instance,
+                   OS_ConfigServiceHandle_getAppId(handle),
+                   entries,
+                   numberOfEntries,
+                   buffer,
+                   bufferSize,
+                   bytesCopied);
+    }
+    else
+    {
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceLibrary_parameterSetValuesBatch(
+    OS_ConfigServiceHandle_t handle,
+    OS_ConfigServiceLibTypes_BatchEntry_t* entries,
+    size_t numberOfEntries,
+    void const* buffer,
+    size_t bufferSize)
+{
+    if (OS_CONFIG_HANDLE_KIND_LOCAL == OS_ConfigServiceHandle_getHandleKind(
+            handle))
+    {
+        OS_ConfigServiceLib_t* instance = (OS_ConfigServiceLib_t*)
+                                          OS_ConfigServiceHandle_getLocalInstance(handle);
+        return OS_ConfigServiceLib_parameterSetValuesBatch(
+                   instance,
+                   OS_ConfigServiceHandle_getAppId(handle),
+                   entries,
+                   numberOfEntries,
+                   buffer,
+                   bufferSize);
+    }
+    else
+    {
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceLibrary_parameterReadBlobRange(
+    OS_ConfigServiceHandle_t handle,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    size_t offset,
+    void* buffer,
+    size_t length,
+    size_t* bytesCopied)
+{
+    if (OS_CONFIG_HANDLE_KIND_LOCAL == OS_ConfigServiceHandle_getHandleKind(
+            handle))
+    {
+        OS_ConfigServiceLib_t* instance = (OS_ConfigServiceLib_t*)
+                                          OS_ConfigServiceHandle_getLocalInstance(handle);
+        return OS_ConfigServiceLib_parameterReadBlobRange(
+                   instance,
+                   OS_ConfigServiceHandle_getAppId(handle),
+                   enumerator,
+                   offset,
+                   buffer,
+                   length,
+                   bytesCopied);
+    }
+    else
+    {
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceLibrary_parameterWriteBlobRange(
+    OS_ConfigServiceHandle_t handle,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    size_t blobSize,
+    size_t offset,
+    void const* buffer,
+    size_t length)
+{
+    if (OS_CONFIG_HANDLE_KIND_LOCAL == OS_ConfigServiceHandle_getHandleKind(
+            handle))
+    {
+        OS_ConfigServiceLib_t* instance = (OS_ConfigServiceLib_t*)
+                                          OS_ConfigServiceHandle_getLocalInstance(handle);
+        return OS_ConfigServiceLib_parameterWriteBlobRange(
+                   instance,
+                   OS_ConfigServiceHandle_getAppId(handle),
+                   enumerator,
+                   blobSize,
+                   offset,
+                   buffer,
+                   length);
+    }
+    else
+    {
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceLibrary_parameterResizeBlob(
+    OS_ConfigServiceHandle_t handle,
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    size_t capacity)
+{
+    if (OS_CONFIG_HANDLE_KIND_LOCAL == OS_ConfigServiceHandle_getHandleKind(
+            handle))
+    {
+        OS_ConfigServiceLib_t* instance = (OS_ConfigServiceLib_t*)
+                                          OS_ConfigServiceHandle_getLocalInstance(handle);
+        return OS_ConfigServiceLib_parameterResizeBlob(
+                   instance,
+                   OS_ConfigServiceHandle_getAppId(handle),
+                   enumerator,
+                   capacity);
+    }
+    else
+    {
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+}
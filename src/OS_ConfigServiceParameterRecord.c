@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2020-2024, HENSOLDT Cyber GmbH
+ * 
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * For commercial licensing, contact: info.cyber@hensoldt.net
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "lib_debug/Debug.h"
+#include "OS_ConfigServiceParameterRecord.h"
+
+#include <string.h>
+
+/* Private types/defines/enums -----------------------------------------------*/
+// 32-bit FNV-1a
+#define FNV_OFFSET_BASIS  2166136261u
+#define FNV_PRIME         16777619u
+
+/* Private functions ---------------------------------------------------------*/
+static
+void
+OS_ConfigServiceParameterRecord_encodeV1Rights(
+    uint8_t* rights,
+    OS_ConfigServiceAccessRights_t const* accessRights)
+{
+    memset(rights, 0, OS_CONFIG_SERVICE_PARAMETER_RECORD_V1_RIGHTS_SIZE);
+
+    for (unsigned int k = 0; k < OS_CONFIG_ACCESS_RIGHTS_MAX_ENTRY; ++k)
+    {
+        if (OS_ConfigServiceAccessRights_IsSet(accessRights, k))
+        {
+            rights[k >> 3] |= 1u << (k & 0x03);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+static
+void
+OS_ConfigServiceParameterRecord_decodeV1Rights(
+    OS_ConfigServiceAccessRights_t* accessRights,
+    uint8_t const* rights)
+{
+    OS_ConfigServiceAccessRights_ClearAll(accessRights);
+
+    for (unsigned int k = 0; k < OS_CONFIG_ACCESS_RIGHTS_MAX_ENTRY; ++k)
+    {
+        if (0 != (rights[k >> 3] & (1u << (k & 0x03))))
+        {
+            OS_ConfigServiceAccessRights_Set(accessRights, k);
+        }
+    }
+}
+
+/* Exported functions --------------------------------------------------------*/
+uint32_t
+OS_ConfigServiceParameterRecord_hashName(
+    OS_ConfigServiceLibTypes_ParameterName_t const* parameterName)
+{
+    uint32_t hash = FNV_OFFSET_BASIS;
+
+    for (unsigned int k = 0;
+         (k < OS_CONFIG_LIB_PARAMETER_NAME_SIZE) && ('\0' != parameterName->name[k]);
+         ++k)
+    {
+        hash ^= (unsigned char)parameterName->name[k];
+        hash *= FNV_PRIME;
+    }
+
+    return hash;
+}
+
+//------------------------------------------------------------------------------
+void
+OS_ConfigServiceParameterRecord_encode(
+    OS_ConfigServiceParameterRecord_t* record,
+    OS_ConfigServiceLibTypes_Parameter_t const* parameter)
+{
+    memset(record, 0, sizeof(*record));
+
+    record->version = OS_CONFIG_SERVICE_PARAMETER_RECORD_VERSION_2;
+    record->parameterType = (uint8_t)parameter->parameterType;
+    record->nameHash = OS_ConfigServiceParameterRecord_hashName(
+                           &parameter->parameterName);
+    record->domainIndex = parameter->domain.index;
+    record->parameterValue = parameter->parameterValue;
+    record->readAccess = parameter->readAccess.mask;
+    record->writeAccess = parameter->writeAccess.mask;
+    memcpy(record->name, parameter->parameterName.name, sizeof(record->name));
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceParameterRecord_decode(
+    OS_ConfigServiceLibTypes_Parameter_t* parameter,
+    OS_ConfigServiceParameterRecord_t const* record)
+{
+    if ((OS_CONFIG_SERVICE_PARAMETER_RECORD_VERSION_NONE != record->version) &&
+        (OS_CONFIG_SERVICE_PARAMETER_RECORD_VERSION_2 != record->version))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_NOT_SUPPORTED;
+    }
+
+    memset(parameter, 0, sizeof(*parameter));
+
+    parameter->parameterType =
+        (OS_ConfigServiceLibTypes_ParameterType_t)record->parameterType;
+    memcpy(parameter->parameterName.name, record->name,
+           sizeof(parameter->parameterName.name));
+    parameter->domain.index = record->domainIndex;
+    parameter->parameterValue = record->parameterValue;
+    parameter->readAccess.mask = record->readAccess;
+    parameter->writeAccess.mask = record->writeAccess;
+
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+void
+OS_ConfigServiceParameterRecord_encodeV1(
+    OS_ConfigServiceParameterRecordV1_t* record,
+    OS_ConfigServiceLibTypes_Parameter_t const* parameter)
+{
+    memset(record, 0, sizeof(*record));
+
+    record->parameterType = (uint32_t)parameter->parameterType;
+    memcpy(record->name, parameter->parameterName.name, sizeof(record->name));
+    record->domainIndex = parameter->domain.index;
+    record->parameterValue = parameter->parameterValue;
+    OS_ConfigServiceParameterRecord_encodeV1Rights(
+        record->readAccess,
+        &parameter->readAccess);
+    OS_ConfigServiceParameterRecord_encodeV1Rights(
+        record->writeAccess,
+        &parameter->writeAccess);
+}
+
+//------------------------------------------------------------------------------
+void
+OS_ConfigServiceParameterRecord_decodeV1(
+    OS_ConfigServiceLibTypes_Parameter_t* parameter,
+    OS_ConfigServiceParameterRecordV1_t const* record)
+{
+    memset(parameter, 0, sizeof(*parameter));
+
+    parameter->parameterType =
+        (OS_ConfigServiceLibTypes_ParameterType_t)record->parameterType;
+    memcpy(parameter->parameterName.name, record->name,
+           sizeof(parameter->parameterName.name));
+    parameter->domain.index = record->domainIndex;
+    parameter->parameterValue = record->parameterValue;
+    OS_ConfigServiceParameterRecord_decodeV1Rights(
+        &parameter->readAccess,
+        record->readAccess);
+    OS_ConfigServiceParameterRecord_decodeV1Rights(
+        &parameter->writeAccess,
+        record->writeAccess);
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceParameterRecord_convertBackend(
+    OS_ConfigServiceBackend_t* v1Backend,
+    OS_ConfigServiceBackend_t* v2Backend)
+{
+    if ((OS_ConfigServiceBackend_getSizeOfRecords(v1Backend) !=
+         sizeof(OS_ConfigServiceParameterRecordV1_t)) ||
+        (OS_ConfigServiceBackend_getSizeOfRecords(v2Backend) !=
+         sizeof(OS_ConfigServiceParameterRecord_t)) ||
+        (OS_ConfigServiceBackend_getNumberOfRecords(v2Backend) <
+         OS_ConfigServiceBackend_getNumberOfRecords(v1Backend)))
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
+    unsigned int numberOfRecords = OS_ConfigServiceBackend_getNumberOfRecords(
+                                       v1Backend);
+
+    for (unsigned int k = 0; k < numberOfRecords; ++k)
+    {
+        OS_ConfigServiceLibTypes_Parameter_t parameter;
+        OS_ConfigServiceParameterRecordV1_t v1Record;
+        OS_ConfigServiceParameterRecord_t record;
+
+        OS_Error_t err = OS_ConfigServiceBackend_readRecord(
+                             v1Backend,
+                             k,
+                             &v1Record,
+                             sizeof(v1Record));
+        if (OS_SUCCESS != err)
+        {
+            Debug_LOG_ERROR("OS_ConfigServiceBackend_readRecord() failed, error %d", err);
+            return err;
+        }
+
+        OS_ConfigServiceParameterRecord_decodeV1(&parameter, &v1Record);
+        OS_ConfigServiceParameterRecord_encode(&record, &parameter);
+
+        err = OS_ConfigServiceBackend_writeRecord(
+                  v2Backend,
+                  k,
+                  &record,
+                  sizeof(record));
+        if (OS_SUCCESS != err)
+        {
+            Debug_LOG_ERROR("OS_ConfigServiceBackend_writeRecord() failed, error %d", err);
+            return err;
+        }
+    }
+
+    return OS_ConfigServiceBackend_flush(v2Backend);
+}
@@ -11,29 +11,77 @@
 
 #include "OS_ConfigServiceServer.h"
 #include "OS_ConfigServiceLibrary.h"
+#include "OS_ConfigServiceSessionTable.h"
 
 #include "lib_debug/Debug.h"
 
 #include <camkes.h>
 
+#include <string.h>
+
 /* Local types ---------------------------------------------------------------*/
 static OS_ConfigServiceLib_t serverInstance = { 0 };
 
 // Not generated yet by camkes
 seL4_Word OS_ConfigServiceServer_get_sender_id(void);
 
-// How many parallel remote instances can we handle? This number can be easily
-// increased, for now it is aligned with the limits of other server systems
-// which are provided by TRENTOS.
-#define MAX_REMOTE_HANDLES 8
-static OS_ConfigServiceHandle_t localHandleCopies[MAX_REMOTE_HANDLES];
+// Every client has a session, found by its CAmkES badge. The capacity can be
+// set with OS_CONFIG_SERVICE_SERVER_MAX_CLIENTS.
+static OS_ConfigServiceSessionTable_t sessionTable;
+
+// Server-local copy of a batch update, see
+// OS_CONFIG_SERVICE_SERVER_BATCH_BUFFER_SIZE.
+static uint64_t batchBuffer[(OS_CONFIG_SERVICE_SERVER_BATCH_BUFFER_SIZE +
+                             sizeof(uint64_t) - 1) / sizeof(uint64_t)];
+
+static OS_ConfigServiceSession_t*
+getSessionOfClient(void)
+{
+    return OS_ConfigServiceSessionTable_find(
+               &sessionTable,
+               OS_ConfigServiceServer_get_sender_id());
+}
 
+// Returns NULL if the client has not created a handle yet.
 static OS_ConfigServiceHandle_t*
 getLocalCopyOfHandle(void)
 {
-    seL4_Word id = OS_ConfigServiceServer_get_sender_id();
-    Debug_ASSERT(id >= 0 && id < MAX_REMOTE_HANDLES);
-    return &localHandleCopies[id];
+    OS_ConfigServiceSession_t* session = getSessionOfClient();
+
+    return (NULL == session) ? NULL : &session->remoteHandle;
+}
+
+// The CAmkES badge of a client is its app ID in the access rights of the
+// parameters. Badges beyond the access rights have no rights at all.
+static unsigned int
+getAppIdOfBadge(
+    seL4_Word id)
+{
+    return (id < OS_CONFIG_ACCESS_RIGHTS_MAX_ENTRY) ?
+           (unsigned int)id : OS_CONFIG_ACCESS_RIGHTS_MAX_ENTRY;
+}
+
+static void
+initLocalHandleOfClient(
+    OS_ConfigServiceHandle_t* handle)
+{
+    OS_ConfigServiceSession_t* session = getSessionOfClient();
+    unsigned int appId;
+
+    if (NULL != session)
+    {
+        session->numberOfRequests++;
+        appId = session->appId;
+    }
+    else
+    {
+        appId = getAppIdOfBadge(OS_ConfigServiceServer_get_sender_id());
+    }
+
+    OS_ConfigServiceHandle_initLocalHandleForApp(
+        &serverInstance,
+        appId,
+        handle);
 }
 
 /* Exported functions --------------------------------------------------------*/
@@ -52,6 +100,7 @@ OS_ConfigServiceServer_createHandle(
     OS_ConfigServiceHandle_t* handle)
 {
     void* ptr;
+    OS_ConfigServiceSession_t* session;
 
     // Make sure that we actually get a dataport here and not some arbitrary
     // memory pointer..
@@ -60,6 +109,19 @@ OS_ConfigServiceServer_createHandle(
         return OS_ERROR_INVALID_PARAMETER;
     }
 
+    seL4_Word id = OS_ConfigServiceServer_get_sender_id();
+
+    OS_Error_t err = OS_ConfigServiceSessionTable_open(
+                         &sessionTable,
+                         id,
+                         &session);
+    if (OS_SUCCESS != err)
+    {
+        Debug_LOG_ERROR("no session left for client %u, error %d",
+                        (unsigned int)id, err);
+        return err;
+    }
+
     // Formerly, the server would init a context and pass it back to the client,
     // which would then send it back so the server knew the dataport etc. for
     // this specific client. Now, we keep the init and sending it back to thew
@@ -71,13 +133,13 @@ OS_ConfigServiceServer_createHandle(
         wrappedDpSize,
         handle);
 
-    // Every client has its own copy which we keep and index based on their
-    // CAmkES badge ID.
+    // Every client has its own copy which we keep in its session.
     OS_ConfigServiceHandle_initRemoteHandle(
         clientCtx,
         ptr,
         wrappedDpSize,
-        getLocalCopyOfHandle());
+        &session->remoteHandle);
+    session->appId = getAppIdOfBadge(id);
 
     return OS_SUCCESS;
 }
@@ -89,9 +151,7 @@ OS_ConfigServiceServer_domainEnumeratorInit(
 {
     OS_ConfigServiceHandle_t localHandle;
 
-    OS_ConfigServiceHandle_initLocalHandle(
-        &serverInstance,
-        &localHandle);
+    initLocalHandleOfClient(&localHandle);
 
     return OS_ConfigServiceLibrary_domainEnumeratorInit(
                localHandle,
@@ -105,9 +165,7 @@ OS_ConfigServiceServer_domainEnumeratorClose(
 {
     OS_ConfigServiceHandle_t localHandle;
 
-    OS_ConfigServiceHandle_initLocalHandle(
-        &serverInstance,
-        &localHandle);
+    initLocalHandleOfClient(&localHandle);
 
     return OS_ConfigServiceLibrary_domainEnumeratorClose(localHandle,
                                                          enumerator);
@@ -120,9 +178,7 @@ OS_ConfigServiceServer_domainEnumeratorReset(
 {
     OS_ConfigServiceHandle_t localHandle;
 
-    OS_ConfigServiceHandle_initLocalHandle(
-        &serverInstance,
-        &localHandle);
+    initLocalHandleOfClient(&localHandle);
 
     return OS_ConfigServiceLibrary_domainEnumeratorReset(localHandle,
                                                          enumerator);
@@ -135,9 +191,7 @@ OS_ConfigServiceServer_domainEnumeratorIncrement(
 {
     OS_ConfigServiceHandle_t localHandle;
 
-    OS_ConfigServiceHandle_initLocalHandle(
-        &serverInstance,
-        &localHandle);
+    initLocalHandleOfClient(&localHandle);
 
     return OS_ConfigServiceLibrary_domainEnumeratorIncrement(
                localHandle,
@@ -152,9 +206,7 @@ OS_ConfigServiceServer_domainEnumeratorGetElement(
 {
     OS_ConfigServiceHandle_t localHandle;
 
-    OS_ConfigServiceHandle_initLocalHandle(
-        &serverInstance,
-        &localHandle);
+    initLocalHandleOfClient(&localHandle);
 
     return OS_ConfigServiceLibrary_domainEnumeratorGetElement(
                localHandle,
@@ -170,9 +222,7 @@ OS_ConfigServiceServer_parameterEnumeratorInit(
 {
     OS_ConfigServiceHandle_t localHandle;
 
-    OS_ConfigServiceHandle_initLocalHandle(
-        &serverInstance,
-        &localHandle);
+    initLocalHandleOfClient(&localHandle);
 
     return OS_ConfigServiceLibrary_parameterEnumeratorInit(
                localHandle,
@@ -187,9 +237,7 @@ OS_ConfigServiceServer_parameterEnumeratorClose(
 {
     OS_ConfigServiceHandle_t localHandle;
 
-    OS_ConfigServiceHandle_initLocalHandle(
-        &serverInstance,
-        &localHandle);
+    initLocalHandleOfClient(&localHandle);
 
     OS_ConfigServiceLibrary_parameterEnumeratorClose(
         localHandle,
@@ -205,9 +253,7 @@ OS_ConfigServiceServer_parameterEnumeratorReset(
 {
     OS_ConfigServiceHandle_t localHandle;
 
-    OS_ConfigServiceHandle_initLocalHandle(
-        &serverInstance,
-        &localHandle);
+    initLocalHandleOfClient(&localHandle);
 
     return OS_ConfigServiceLibrary_parameterEnumeratorReset(
                localHandle,
@@ -221,9 +267,7 @@ OS_ConfigServiceServer_parameterEnumeratorIncrement(
 {
     OS_ConfigServiceHandle_t localHandle;
 
-    OS_ConfigServiceHandle_initLocalHandle(
-        &serverInstance,
-        &localHandle);
+    initLocalHandleOfClient(&localHandle);
 
     return OS_ConfigServiceLibrary_parameterEnumeratorIncrement(
                localHandle,
@@ -238,9 +282,7 @@ OS_ConfigServiceServer_parameterEnumeratorGetElement(
 {
     OS_ConfigServiceHandle_t localHandle;
 
-    OS_ConfigServiceHandle_initLocalHandle(
-        &serverInstance,
-        &localHandle);
+    initLocalHandleOfClient(&localHandle);
 
     return OS_ConfigServiceLibrary_parameterEnumeratorGetElement(localHandle,
             enumerator, parameter);
@@ -264,9 +306,7 @@ OS_ConfigServiceServer_domainCreateParameterEnumerator(
 {
     OS_ConfigServiceHandle_t localHandle;
 
-    OS_ConfigServiceHandle_initLocalHandle(
-        &serverInstance,
-        &localHandle);
+    initLocalHandleOfClient(&localHandle);
 
     return OS_ConfigServiceLibrary_domainCreateParameterEnumerator(
                localHandle,
@@ -284,9 +324,7 @@ OS_ConfigServiceServer_domainGetElement(
 {
     OS_ConfigServiceHandle_t localHandle;
 
-    OS_ConfigServiceHandle_initLocalHandle(
-        &serverInstance,
-        &localHandle);
+    initLocalHandleOfClient(&localHandle);
 
     return OS_ConfigServiceLibrary_domainGetElement(
                localHandle,
@@ -331,9 +369,12 @@ OS_ConfigServiceServer_parameterGetValue(
     OS_ConfigServiceHandle_t* copyOfRemoteHandle = getLocalCopyOfHandle();
     OS_ConfigServiceHandle_t localHandle;
 
-    OS_ConfigServiceHandle_initLocalHandle(
-        &serverInstance,
-        &localHandle);
+    if (NULL == copyOfRemoteHandle)
+    {
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    initLocalHandleOfClient(&localHandle);
 
     if (bufferSize > copyOfRemoteHandle->context.rpc.dataportSize)
     {
@@ -356,9 +397,7 @@ OS_ConfigServiceServer_parameterGetValueAsU32(
 {
     OS_ConfigServiceHandle_t localHandle;
 
-    OS_ConfigServiceHandle_initLocalHandle(
-        &serverInstance,
-        &localHandle);
+    initLocalHandleOfClient(&localHandle);
 
     return OS_ConfigServiceLibrary_parameterGetValueAsU32(
                localHandle,
@@ -374,9 +413,7 @@ OS_ConfigServiceServer_parameterGetValueAsU64(
 {
     OS_ConfigServiceHandle_t localHandle;
 
-    OS_ConfigServiceHandle_initLocalHandle(
-        &serverInstance,
-        &localHandle);
+    initLocalHandleOfClient(&localHandle);
 
     return OS_ConfigServiceLibrary_parameterGetValueAsU64(
                localHandle,
@@ -393,9 +430,12 @@ OS_ConfigServiceServer_parameterGetValueAsString(
     OS_ConfigServiceHandle_t* copyOfRemoteHandle = getLocalCopyOfHandle();
     OS_ConfigServiceHandle_t localHandle;
 
-    OS_ConfigServiceHandle_initLocalHandle(
-        &serverInstance,
-        &localHandle);
+    if (NULL == copyOfRemoteHandle)
+    {
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    initLocalHandleOfClient(&localHandle);
 
     if (bufferSize > copyOfRemoteHandle->context.rpc.dataportSize)
     {
@@ -419,9 +459,12 @@ OS_ConfigServiceServer_parameterGetValueAsBlob(
     OS_ConfigServiceHandle_t* copyOfRemoteHandle = getLocalCopyOfHandle();
     OS_ConfigServiceHandle_t localHandle;
 
-    OS_ConfigServiceHandle_initLocalHandle(
-        &serverInstance,
-        &localHandle);
+    if (NULL == copyOfRemoteHandle)
+    {
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    initLocalHandleOfClient(&localHandle);
 
     if (bufferSize > copyOfRemoteHandle->context.rpc.dataportSize)
     {
@@ -445,9 +488,12 @@ OS_ConfigServiceServer_parameterSetValue(
     OS_ConfigServiceHandle_t* copyOfRemoteHandle = getLocalCopyOfHandle();
     OS_ConfigServiceHandle_t localHandle;
 
-    OS_ConfigServiceHandle_initLocalHandle(
-        &serverInstance,
-        &localHandle);
+    if (NULL == copyOfRemoteHandle)
+    {
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    initLocalHandleOfClient(&localHandle);
 
     if (bufferSize > copyOfRemoteHandle->context.rpc.dataportSize)
     {
@@ -470,9 +516,7 @@ OS_ConfigServiceServer_parameterSetValueAsU32(
 {
     OS_ConfigServiceHandle_t localHandle;
 
-    OS_ConfigServiceHandle_initLocalHandle(
-        &serverInstance,
-        &localHandle);
+    initLocalHandleOfClient(&localHandle);
 
     return OS_ConfigServiceLibrary_parameterSetValueAsU32(
                localHandle,
@@ -488,9 +532,7 @@ OS_ConfigServiceServer_parameterSetValueAsU64(
 {
     OS_ConfigServiceHandle_t localHandle;
 
-    OS_ConfigServiceHandle_initLocalHandle(
-        &serverInstance,
-        &localHandle);
+    initLocalHandleOfClient(&localHandle);
 
     return OS_ConfigServiceLibrary_parameterSetValueAsU64(
                localHandle,
@@ -508,9 +550,12 @@ OS_ConfigServiceServer_parameterSetValueAsString(
     OS_ConfigServiceHandle_t* copyOfRemoteHandle = getLocalCopyOfHandle();
     OS_ConfigServiceHandle_t localHandle;
 
-    OS_ConfigServiceHandle_initLocalHandle(
-        &serverInstance,
-        &localHandle);
+    if (NULL == copyOfRemoteHandle)
+    {
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    initLocalHandleOfClient(&localHandle);
 
     if (bufferSize > copyOfRemoteHandle->context.rpc.dataportSize)
     {
@@ -535,9 +580,12 @@ OS_ConfigServiceServer_parameterSetValueAsBlob(
     OS_ConfigServiceHandle_t* copyOfRemoteHandle = getLocalCopyOfHandle();
     OS_ConfigServiceHandle_t localHandle;
 
-    OS_ConfigServiceHandle_initLocalHandle(
-        &serverInstance,
-        &localHandle);
+    if (NULL == copyOfRemoteHandle)
+    {
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    initLocalHandleOfClient(&localHandle);
 
     if (bufferSize > copyOfRemoteHandle->context.rpc.dataportSize)
     {
@@ -564,9 +612,12 @@ OS_ConfigServiceServer_parameterGetValueFromDomainName(
     OS_ConfigServiceHandle_t* copyOfRemoteHandle = getLocalCopyOfHandle();
     OS_ConfigServiceHandle_t localHandle;
 
-    OS_ConfigServiceHandle_initLocalHandle(
-        &serverInstance,
-        &localHandle);
+    if (NULL == copyOfRemoteHandle)
+    {
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    initLocalHandleOfClient(&localHandle);
 
     if (bufferSize > copyOfRemoteHandle->context.rpc.dataportSize)
     {
@@ -583,4 +634,266 @@ OS_ConfigServiceServer_parameterGetValueFromDomainName(
                bytesCopied);
 }
 
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceServer_parameterResolve(
+    OS_ConfigServiceLibTypes_DomainName_t const* domainName,
+    OS_ConfigServiceLibTypes_ParameterName_t const* parameterName,
+    OS_ConfigServiceLibTypes_ParameterId_t* parameterId)
+{
+    OS_ConfigServiceHandle_t localHandle;
+
+    initLocalHandleOfClient(&localHandle);
+
+    return OS_ConfigServiceLibrary_parameterResolve(
+               localHandle,
+               domainName,
+               parameterName,
+               parameterId);
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceServer_parameterGetValueById(
+    OS_ConfigServiceLibTypes_ParameterId_t parameterId,
+    OS_ConfigServiceLibTypes_ParameterType_t parameterType,
+    size_t bufferSize,
+    size_t* bytesCopied)
+{
+    OS_ConfigServiceHandle_t* copyOfRemoteHandle = getLocalCopyOfHandle();
+    OS_ConfigServiceHandle_t localHandle;
+
+    if (NULL == copyOfRemoteHandle)
+    {
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    initLocalHandleOfClient(&localHandle);
+
+    if (bufferSize > copyOfRemoteHandle->context.rpc.dataportSize)
+    {
+        return OS_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    return OS_ConfigServiceLibrary_parameterGetValueById(
+               localHandle,
+               parameterId,
+               parameterType,
+               copyOfRemoteHandle->context.rpc.dataport,
+               bufferSize,
+               bytesCopied);
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceServer_parameterSetValueById(
+    OS_ConfigServiceLibTypes_ParameterId_t parameterId,
+    OS_ConfigServiceLibTypes_ParameterType_t parameterType,
+    size_t bufferSize)
+{
+    OS_ConfigServiceHandle_t* copyOfRemoteHandle = getLocalCopyOfHandle();
+    OS_ConfigServiceHandle_t localHandle;
+
+    if (NULL == copyOfRemoteHandle)
+    {
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    initLocalHandleOfClient(&localHandle);
+
+    if (bufferSize > copyOfRemoteHandle->context.rpc.dataportSize)
+    {
+        return OS_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    return OS_ConfigServiceLibrary_parameterSetValueById(
+               localHandle,
+               parameterId,
+               parameterType,
+               copyOfRemoteHandle->context.rpc.dataport,
+               bufferSize);
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceServer_parameterGetValuesBatch(
+    size_t numberOfEntries,
+    size_t bufferSize,
+    size_t* bytesCopied)
+{
+    OS_ConfigServiceHandle_t* copyOfRemoteHandle = getLocalCopyOfHandle();
+    OS_ConfigServiceHandle_t localHandle;
+
+    if (NULL == copyOfRemoteHandle)
+    {
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    initLocalHandleOfClient(&localHandle);
+
+    size_t dataportSize = copyOfRemoteHandle->context.rpc.dataportSize;
+
+    *bytesCopied = 0;
+
+    if ((numberOfEntries > dataportSize /
+         sizeof(OS_ConfigServiceLibTypes_BatchEntry_t)) ||
+        (OS_CONFIG_LIB_BATCH_VALUES_OFFSET(numberOfEntries) > dataportSize) ||
+        (bufferSize > dataportSize -
+         OS_CONFIG_LIB_BATCH_VALUES_OFFSET(numberOfEntries)))
+    {
+        return OS_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    char* dataport = copyOfRemoteHandle->context.rpc.dataport;
+
+    return OS_ConfigServiceLibrary_parameterGetValuesBatch(
+               localHandle,
+               (OS_ConfigServiceLibTypes_BatchEntry_t*)dataport,
+               numberOfEntries,
+               dataport + OS_CONFIG_LIB_BATCH_VALUES_OFFSET(numberOfEntries),
+               bufferSize,
+               bytesCopied);
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceServer_parameterSetValuesBatch(
+    size_t numberOfEntries,
+    size_t bufferSize)
+{
+    OS_ConfigServiceHandle_t* copyOfRemoteHandle = getLocalCopyOfHandle();
+    OS_ConfigServiceHandle_t localHandle;
+
+    if (NULL == copyOfRemoteHandle)
+    {
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    initLocalHandleOfClient(&localHandle);
+
+    size_t dataportSize = copyOfRemoteHandle->context.rpc.dataportSize;
+
+    if ((numberOfEntries > dataportSize /
+         sizeof(OS_ConfigServiceLibTypes_BatchEntry_t)) ||
+        (OS_CONFIG_LIB_BATCH_VALUES_OFFSET(numberOfEntries) > dataportSize) ||
+        (bufferSize > dataportSize -
+         OS_CONFIG_LIB_BATCH_VALUES_OFFSET(numberOfEntries)))
+    {
+        return OS_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    size_t valuesOffset = OS_CONFIG_LIB_BATCH_VALUES_OFFSET(numberOfEntries);
+
+    if ((valuesOffset > sizeof(batchBuffer)) ||
+        (bufferSize > sizeof(batchBuffer) - valuesOffset))
+    {
+        Debug_LOG_ERROR("batch of %zu bytes exceeds the server buffer",
+                        valuesOffset + bufferSize);
+        return OS_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    // Work on a copy, the client shares the dataport and could change the
+    // entries or values after they have been checked.
+    char* dataport = copyOfRemoteHandle->context.rpc.dataport;
+    char* batch = (char*)batchBuffer;
+
+    memcpy(batch, dataport, valuesOffset + bufferSize);
+
+    OS_Error_t err = OS_ConfigServiceLibrary_parameterSetValuesBatch(
+                         localHandle,
+                         (OS_ConfigServiceLibTypes_BatchEntry_t*)batch,
+                         numberOfEntries,
+                         batch + valuesOffset,
+                         bufferSize);
+
+    // The resolved IDs and the results are returned in the entries.
+    memcpy(dataport,
+           batch,
+           numberOfEntries * sizeof(OS_ConfigServiceLibTypes_BatchEntry_t));
+
+    return err;
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceServer_parameterReadBlobRange(
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    size_t offset,
+    size_t length,
+    size_t* bytesCopied)
+{
+    OS_ConfigServiceHandle_t* copyOfRemoteHandle = getLocalCopyOfHandle();
+    OS_ConfigServiceHandle_t localHandle;
+
+    if (NULL == copyOfRemoteHandle)
+    {
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    initLocalHandleOfClient(&localHandle);
+
+    *bytesCopied = 0;
+
+    if (length > copyOfRemoteHandle->context.rpc.dataportSize)
+    {
+        return OS_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    return OS_ConfigServiceLibrary_parameterReadBlobRange(
+               localHandle,
+               enumerator,
+               offset,
+               copyOfRemoteHandle->context.rpc.dataport,
+               length,
+               bytesCopied);
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceServer_parameterWriteBlobRange(
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    size_t blobSize,
+    size_t offset,
+    size_t length)
+{
+    OS_ConfigServiceHandle_t* copyOfRemoteHandle = getLocalCopyOfHandle();
+    OS_ConfigServiceHandle_t localHandle;
+
+    if (NULL == copyOfRemoteHandle)
+    {
+        return OS_ERROR_INVALID_STATE;
+    }
+
+    initLocalHandleOfClient(&localHandle);
+
+    if (length > copyOfRemoteHandle->context.rpc.dataportSize)
+    {
+        return OS_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    return OS_ConfigServiceLibrary_parameterWriteBlobRange(
+               localHandle,
+               enumerator,
+               blobSize,
+               offset,
+               copyOfRemoteHandle->context.rpc.dataport,
+               length);
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceServer_parameterResizeBlob(
+    OS_ConfigServiceLibTypes_ParameterEnumerator_t const* enumerator,
+    size_t capacity)
+{
+    OS_ConfigServiceHandle_t localHandle;
+
+    initLocalHandleOfClient(&localHandle);
+
+    return OS_ConfigServiceLibrary_parameterResizeBlob(
+               localHandle,
+               enumerator,
+               capacity);
+}
+
 #endif
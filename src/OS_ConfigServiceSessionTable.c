@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2020-2024, HENSOLDT Cyber GmbH
+ * 
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * For commercial licensing, contact: info.cyber@hensoldt.net
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "lib_debug/Debug.h"
+#include "OS_ConfigServiceSessionTable.h"
+
+#include <string.h>
+
+/* Private functions ---------------------------------------------------------*/
+
+// Badges are usually small consecutive numbers, multiplicative hashing spreads
+// them over the slots.
+static
+uint32_t
+OS_ConfigServiceSessionTable_getFirstSlot(
+    uintptr_t badge)
+{
+    uint64_t hash = (uint64_t)badge * 0x9E3779B97F4A7C15ull;
+
+    return (uint32_t)(hash >> 32) % OS_CONFIG_SERVICE_SESSION_TABLE_SLOTS;
+}
+
+//------------------------------------------------------------------------------
+// Returns the slot holding the given badge or the empty slot ending its probe
+// sequence. Sessions are never removed, so the table always has empty slots.
+static
+uint32_t
+OS_ConfigServiceSessionTable_probe(
+    OS_ConfigServiceSessionTable_t const* table,
+    uintptr_t badge)
+{
+    uint32_t slot = OS_ConfigServiceSessionTable_getFirstSlot(badge);
+
+    while (0 != table->slots[slot])
+    {
+        if (table->sessions[table->slots[slot] - 1].badge == badge)
+        {
+            break;
+        }
+        slot = (slot + 1) % OS_CONFIG_SERVICE_SESSION_TABLE_SLOTS;
+    }
+
+    return slot;
+}
+
+/* Exported functions --------------------------------------------------------*/
+void
+OS_ConfigServiceSessionTable_init(
+    OS_ConfigServiceSessionTable_t* table)
+{
+    memset(table, 0, sizeof(*table));
+}
+
+//------------------------------------------------------------------------------
+OS_Error_t
+OS_ConfigServiceSessionTable_open(
+    OS_ConfigServiceSessionTable_t* table,
+    uintptr_t badge,
+    OS_ConfigServiceSession_t** session)
+{
+    uint32_t slot = OS_ConfigServiceSessionTable_probe(table, badge);
+
+    if (0 != table->slots[slot])
+    {
+        *session = &table->sessions[table->slots[slot] - 1];
+        return OS_SUCCESS;
+    }
+
+    if (table->numberOfSessions >= OS_CONFIG_SERVICE_SERVER_MAX_CLIENTS)
+    {
+        Debug_LOG_DEBUG("Error: function: %s - line: %d\n", __FUNCTION__, __LINE__);
+        return OS_ERROR_INSUFFICIENT_SPACE;
+    }
+
+    OS_ConfigServiceSession_t* newSession =
+        &table->sessions[table->numberOfSessions];
+
+    memset(newSession, 0, sizeof(*newSession));
+    newSession->badge = badge;
+
+    table->numberOfSessions++;
+    table->slots[slot] = table->numberOfSessions;
+
+    *session = newSession;
+    return OS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+OS_ConfigServiceSession_t*
+OS_ConfigServiceSessionTable_find(
+    OS_ConfigServiceSessionTable_t* table,
+    uintptr_t badge)
+{
+    uint32_t slot = OS_ConfigServiceSessionTable_probe(table, badge);
+
+    if (0 == table->slots[slot])
+    {
+        return NULL;
+    }
+
+    return &table->sessions[table->slots[slot] - 1];
+}
+
+//------------------------------------------------------------------------------
+unsigned int
+OS_ConfigServiceSessionTable_getNumberOfSessions(
+    OS_ConfigServiceSessionTable_t const* table)
+{
+    return table->numberOfSessions;
+}